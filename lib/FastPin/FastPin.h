@@ -0,0 +1,106 @@
+// FastPin.h
+// Direct GPIO access for the pins on the hot paths of the display and
+// sensor drivers (DC/CS of the OLED, the bit-banged I2C of the SI1143).
+//
+// digitalWrite() looks the pin up in g_ADigitalPinMap and goes through a
+// function call on every toggle. On the nRF51 FastPin<n> is a single store
+// of a constant mask to NRF_GPIO->OUTSET/OUTCLR/DIRSET/DIRCLR instead. The
+// template argument is the P0.n GPIO number, on the ID107 variant that is
+// the same as the Arduino pin number.
+//
+// Other cores fall back to the Arduino calls, so drivers can use FastPin
+// unconditionally.
+
+#ifndef FastPin_h
+#define FastPin_h
+
+#include <Arduino.h>
+
+#if defined(NRF51)
+
+template <uint8_t pin>
+struct FastPin
+{
+   static_assert(pin < 32, "the nRF51 has 32 GPIOs");
+   static const uint32_t mask = 1UL << pin;
+
+   // Full configuration like pinMode() (OUTPUT, INPUT or INPUT_PULLUP),
+   // the input buffer stays connected so read() works in both directions
+   static inline void mode(uint8_t value)
+   {
+      NRF_GPIO->PIN_CNF[pin] =
+          ((value == OUTPUT ? GPIO_PIN_CNF_DIR_Output : GPIO_PIN_CNF_DIR_Input) << GPIO_PIN_CNF_DIR_Pos) |
+          (GPIO_PIN_CNF_INPUT_Connect << GPIO_PIN_CNF_INPUT_Pos) |
+          ((value == INPUT_PULLUP ? GPIO_PIN_CNF_PULL_Pullup : GPIO_PIN_CNF_PULL_Disabled) << GPIO_PIN_CNF_PULL_Pos) |
+          (GPIO_PIN_CNF_DRIVE_S0S1 << GPIO_PIN_CNF_DRIVE_Pos) |
+          (GPIO_PIN_CNF_SENSE_Disabled << GPIO_PIN_CNF_SENSE_Pos);
+   }
+
+   // Only flip the direction, keeps pull and input buffer from mode()
+   static inline void output() { NRF_GPIO->DIRSET = mask; }
+   static inline void input() { NRF_GPIO->DIRCLR = mask; }
+
+   static inline void high() { NRF_GPIO->OUTSET = mask; }
+   static inline void low() { NRF_GPIO->OUTCLR = mask; }
+   static inline void write(uint8_t value)
+   {
+      if (value)
+         high();
+      else
+         low();
+   }
+   static inline uint8_t read() { return (NRF_GPIO->IN >> pin) & 1; }
+};
+
+// The same for a pin that is only known at run time (constructor
+// arguments), the mask is looked up once in begin()
+class FastPinMask
+{
+  public:
+   inline void begin(uint8_t arduinoPin) { mask = 1UL << g_ADigitalPinMap[arduinoPin]; }
+
+   inline void high() const { NRF_GPIO->OUTSET = mask; }
+   inline void low() const { NRF_GPIO->OUTCLR = mask; }
+   inline void write(uint8_t value) const
+   {
+      if (value)
+         high();
+      else
+         low();
+   }
+
+  private:
+   uint32_t mask;
+};
+
+#else
+
+template <uint8_t pin>
+struct FastPin
+{
+   static inline void mode(uint8_t value) { pinMode(pin, value); }
+   static inline void output() { pinMode(pin, OUTPUT); }
+   static inline void input() { pinMode(pin, INPUT); }
+
+   static inline void high() { digitalWrite(pin, HIGH); }
+   static inline void low() { digitalWrite(pin, LOW); }
+   static inline void write(uint8_t value) { digitalWrite(pin, value ? HIGH : LOW); }
+   static inline uint8_t read() { return digitalRead(pin); }
+};
+
+class FastPinMask
+{
+  public:
+   inline void begin(uint8_t arduinoPin) { pin = arduinoPin; }
+
+   inline void high() const { digitalWrite(pin, HIGH); }
+   inline void low() const { digitalWrite(pin, LOW); }
+   inline void write(uint8_t value) const { digitalWrite(pin, value ? HIGH : LOW); }
+
+  private:
+   uint8_t pin;
+};
+
+#endif
+
+#endif
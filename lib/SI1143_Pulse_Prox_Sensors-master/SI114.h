@@ -16,6 +16,7 @@
 
 #include <stdint.h>
 #include <avr/pgmspace.h>
+#include <FastPin.h>
 //#include <util/delay.h>
 
 
@@ -123,6 +124,11 @@ protected:
     { return 0; }
       
 #else //JJ
+#define SI114_FASTPIN // fixed pins, toggled through FastPin
+    typedef FastPin<22> SdaPin;
+    typedef FastPin<23> SclPin;
+    typedef FastPin<24> IrqPin;
+
     inline uint8_t digiPin() const
         { return 22; } //SDA
     inline uint8_t digiPin2() const
@@ -138,36 +144,63 @@ public:
     inline Port (uint8_t num) : portNum (num) {}
 
     // DIO pin
+#ifdef SI114_FASTPIN
+    inline void mode(uint8_t value) const
+        { SdaPin::mode(value); }
+    inline uint8_t digiRead() const
+        { return SdaPin::read(); }
+    inline void digiWrite(uint8_t value) const
+        { SdaPin::write(value); }
+#else
     inline void mode(uint8_t value) const
         { pinMode(digiPin(), value); }
     inline uint8_t digiRead() const
         { return digitalRead(digiPin()); }
     inline void digiWrite(uint8_t value) const
         { return digitalWrite(digiPin(), value); }
+#endif
     inline void anaWrite(uint8_t val) const
         { analogWrite(digiPin(), val); }
     inline uint32_t pulse(uint8_t state, uint32_t timeout =1000000L) const
         { return pulseIn(digiPin(), state, timeout); }
     
     // AIO pin
-    inline void mode2(uint8_t value) const
-        { pinMode(digiPin2(), value); }
     inline uint16_t anaRead() const
         { return analogRead(anaPin()); }        
+#ifdef SI114_FASTPIN
+    inline void mode2(uint8_t value) const
+        { SclPin::mode(value); }
+    inline uint8_t digiRead2() const
+        { return SclPin::read(); }
+    inline void digiWrite2(uint8_t value) const
+        { SclPin::write(value); }
+#else
+    inline void mode2(uint8_t value) const
+        { pinMode(digiPin2(), value); }
     inline uint8_t digiRead2() const
         { return digitalRead(digiPin2()); }
     inline void digiWrite2(uint8_t value) const
         { return digitalWrite(digiPin2(), value); }
+#endif
     inline uint32_t pulse2(uint8_t state, uint32_t timeout =1000000L) const
         { return pulseIn(digiPin2(), state, timeout); }
         
     // IRQ pin (INT1, shared across all ports)
+#ifdef SI114_FASTPIN
+    static void mode3(uint8_t value)
+        { IrqPin::mode(value); }
+    static uint8_t digiRead3()
+        { return IrqPin::read(); }
+    static void digiWrite3(uint8_t value)
+        { IrqPin::write(value); }
+#else
     static void mode3(uint8_t value)
         { pinMode(digiPin3(), value); }
     static uint8_t digiRead3()
         { return digitalRead(digiPin3()); }
     static void digiWrite3(uint8_t value)
         { return digitalWrite(digiPin3(), value); }
+#endif
     static void anaWrite3(uint8_t val)
         { analogWrite(digiPin3(), val); }
         
@@ -49,10 +49,63 @@
 
 #define OLEDDISPLAY_DISPLAY_BUFFER_SIZE (OLEDDISPLAY_DISPLAY_HEIGHT * OLEDDISPLAY_DISPLAY_WIDTH / 8)
 
-// Disable DOUBLE BUFFERING by default
+// SSD1306 and SH1106 have at most 8 pages of GRAM
+#define OLEDDISPLAY_MAX_PAGES 8
+
+// display() sends the column spans the draw functions touched. To narrow
+// that down to what really changed since the last flush define one of
+//   OLEDDISPLAY_DOUBLE_BUFFER  keep a copy of the last frame and diff it
+//                              (_display_buffer_size bytes of extra RAM)
+//   OLEDDISPLAY_PAGE_HASH      keep a 32 bit hash per OLEDDISPLAY_PAGE_HASH_SEGMENT
+//                              columns of every page (256 bytes at 128x64)
+#if defined(OLEDDISPLAY_DOUBLE_BUFFER) && defined(OLEDDISPLAY_PAGE_HASH)
+#error "Define only one of OLEDDISPLAY_DOUBLE_BUFFER and OLEDDISPLAY_PAGE_HASH"
+#endif
+#if !defined(OLEDDISPLAY_DOUBLE_BUFFER) && !defined(OLEDDISPLAY_PAGE_HASH)
 #define OLEDDISPLAY_REDUCE_MEMORY
-#ifndef OLEDDISPLAY_REDUCE_MEMORY
-#define OLEDDISPLAY_DOUBLE_BUFFER
+#endif
+#ifndef OLEDDISPLAY_PAGE_HASH_SEGMENT
+#define OLEDDISPLAY_PAGE_HASH_SEGMENT 16
+#endif
+
+// Define OLEDDISPLAY_GLYPH_CACHE to a number of glyphs drawString() keeps
+// rendered, already shifted to the row they were drawn at, and reuses least
+// recently used first. A slot holds OLEDDISPLAY_GLYPH_CACHE_BYTES of
+// columns (bigger glyphs are drawn from the font every time) and costs
+// about 20 bytes more. Size it for all glyphs of a frame, a smaller LRU cache misses
+// on every glyph: a clock in ArialMT_Plain_10 on two rows needs 22 slots
+#if defined(OLEDDISPLAY_GLYPH_CACHE) && !defined(OLEDDISPLAY_GLYPH_CACHE_BYTES)
+#define OLEDDISPLAY_GLYPH_CACHE_BYTES 24
+#endif
+
+// The font text is drawn in until setFont() is called. The constructor
+// references it, so it is linked in any case. Firmware that only draws with
+// other fonts (an OLEDFontSubset for example) can define this to nullptr and
+// must then call setFont() before drawing text
+#ifndef OLEDDISPLAY_DEFAULT_FONT
+#define OLEDDISPLAY_DEFAULT_FONT ArialMT_Plain_10
+#endif
+
+// Define OLEDDISPLAY_DISPLAY_LIST to a number of bytes to draw without a
+// framebuffer. The draw functions append an entry to a display list of that
+// size instead (3 to 13 bytes, drawString() adds the text of every line) and
+// display() replays the list once per page into a buffer of one page, which
+// it sends right away. That is _display_width bytes plus the list instead of
+// _display_buffer_size, paid for with drawing the frame once per page.
+//   - clear() empties the list, drawing on top of the last frame makes it grow
+//   - images and fonts are referenced, they have to stay until display()
+//   - `buffer` is the page buffer, don't write to it
+//   - displayAsync() flushes synchronously
+// OLEDDISPLAY_PAGE_HASH still skips the segments that didn't change
+#if defined(OLEDDISPLAY_DISPLAY_LIST) && defined(OLEDDISPLAY_DOUBLE_BUFFER)
+#error "OLEDDISPLAY_DISPLAY_LIST has no frame to diff, use OLEDDISPLAY_PAGE_HASH"
+#endif
+
+// Transports that can run displayAsync() from an interrupt, the others
+// flush synchronously and then call the callback
+#if !defined(OLEDDISPLAY_DISPLAY_LIST) && \
+    ((OLEDDISPLAY_MODE == OLEDDISPLAY_MODE_SPI && defined(NRF51)) || (OLEDDISPLAY_MODE == OLEDDISPLAY_MODE_HOST))
+#define OLEDDISPLAY_ASYNC_TRANSPORT
 #endif
 
 // Header Values
@@ -68,6 +121,10 @@
 #define FIRST_CHAR_POS 2
 #define CHAR_NUM_POS 3
 
+// Set in the width byte of fonts whose glyphs are run length encoded by
+// tools/fontrle.py (OLEDDisplayFontsRLE.h)
+#define FONT_RLE 0x80
+
 // Display commands
 #define CHARGEPUMP 0x8D
 
@@ -97,7 +154,7 @@
 #define SETSTARTLINE 0x40
 #define SETVCOMDETECT 0xDB
 #define SWITCHCAPVCC 0x2
-#define DEACTIVATESCROLL 0x2
+#define DEACTIVATESCROLL 0x2E
 
 #if (OLEDDISPLAY_CHIPSET == OLEDDISPLAY_TYPE_SH1106) // currently these values are unused
 #define SH1106_SET_PUMP_VOLTAGE 0X30
@@ -119,6 +176,40 @@
 #define max(a,b) ((a) > (b) ? (a) : (b))
 #endif
 
+// drawXbm transposes this many 8x8 blocks (on the stack) per blit
+#ifndef OLEDDISPLAY_XBM_CHUNK_BLOCKS
+#define OLEDDISPLAY_XBM_CHUNK_BLOCKS 4
+#endif
+
+// Advance widths of this many font codes from the first character of the
+// font are copied into every display object, so measuring text is one
+// lookup per character. Codes past them are read from the font's jump table.
+// The default covers ASCII from the space. The subset fonts of
+// OLEDDisplayFontSubset.h only need their charNum
+#ifndef OLEDDISPLAY_FONT_METRICS_CHARS
+#define OLEDDISPLAY_FONT_METRICS_CHARS 96
+#endif
+
+#if OLEDDISPLAY_FONT_METRICS_CHARS < 1 || OLEDDISPLAY_FONT_METRICS_CHARS > 255
+#error "OLEDDISPLAY_FONT_METRICS_CHARS has to be 1 to 255"
+#endif
+
+// Circles, rounded rectangles and progress bars up to this radius are drawn
+// in column runs from a table of spans (3 bytes per unit of radius), built
+// on the stack by every call. Bigger circles are drawn pixel by pixel,
+// bigger corners are clamped to it. Define OLEDDISPLAY_CIRCLE_SPAN_CACHE to
+// keep the tables of the last two radii in the display object instead
+#ifndef OLEDDISPLAY_CIRCLE_SPAN_RADIUS
+#define OLEDDISPLAY_CIRCLE_SPAN_RADIUS 32
+#endif
+
+#if OLEDDISPLAY_CIRCLE_SPAN_RADIUS < 2 || OLEDDISPLAY_CIRCLE_SPAN_RADIUS > 255
+#error "OLEDDISPLAY_CIRCLE_SPAN_RADIUS has to be 2 to 255"
+#endif
+
+// Word sized framebuffer access for the run fills
+typedef uint32_t __attribute__((__may_alias__)) oled_word_t;
+
 enum OLEDDISPLAY_COLOR
 {
    BLACK   = 0,
@@ -134,6 +225,417 @@ enum OLEDDISPLAY_TEXT_ALIGNMENT
    TEXT_ALIGN_CENTER_BOTH = 3
 };
 
+// Turns 8 XBM rows (LSB = leftmost pixel) into 8 page format columns
+// (LSB = top pixel), the 32 bit transpose from Hacker's Delight 7-3
+inline void oledTranspose8x8(const uint8_t rows[8], uint8_t columns[8])
+{
+   uint32_t x = ((uint32_t)rows[7] << 24) | ((uint32_t)rows[6] << 16) | ((uint32_t)rows[5] << 8) | rows[4];
+   uint32_t y = ((uint32_t)rows[3] << 24) | ((uint32_t)rows[2] << 16) | ((uint32_t)rows[1] << 8) | rows[0];
+   uint32_t t;
+
+   t = (x ^ (x >> 7)) & 0x00AA00AA;
+   x = x ^ t ^ (t << 7);
+   t = (y ^ (y >> 7)) & 0x00AA00AA;
+   y = y ^ t ^ (t << 7);
+
+   t = (x ^ (x >> 14)) & 0x0000CCCC;
+   x = x ^ t ^ (t << 14);
+   t = (y ^ (y >> 14)) & 0x0000CCCC;
+   y = y ^ t ^ (t << 14);
+
+   t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+   y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+   x = t;
+
+   columns[0] = y;
+   columns[1] = y >> 8;
+   columns[2] = y >> 16;
+   columns[3] = y >> 24;
+   columns[4] = x;
+   columns[5] = x >> 8;
+   columns[6] = x >> 16;
+   columns[7] = x >> 24;
+}
+
+// One MurmurHash3 round, used by OLEDDISPLAY_PAGE_HASH to fingerprint a
+// segment of a page
+inline uint32_t oledHashRound(uint32_t hash, uint32_t k)
+{
+   k *= 0xCC9E2D51;
+   k = (k << 15) | (k >> 17);
+   k *= 0x1B873593;
+   hash ^= k;
+   hash = (hash << 13) | (hash >> 19);
+   return hash * 5 + 0xE6546B64;
+}
+
+inline uint32_t oledSegmentHash(const uint8_t *data, uint8_t length)
+{
+   uint32_t hash = length;
+   if (((uintptr_t)data & 3) == 0)
+   {
+      for (; length >= 4; length -= 4, data += 4) hash = oledHashRound(hash, *(const oled_word_t *)data);
+   }
+   while (length--) hash = oledHashRound(hash, *data++);
+   return hash;
+}
+
+// Pre-clipped column-major blit, set up by OLEDDisplay::setupBlit()
+struct OLEDBlit
+{
+   const char *source;       // first visible source column
+   int16_t firstColumn;      // its index in the bitmap
+   uint8_t *lowTarget;       // where row lowStart of that column lands
+   uint8_t *highTarget;      // where the spill of row highStart lands
+   int16_t columns;          // visible columns
+   uint8_t rasterHeight;     // source bytes per column
+   uint8_t lastColumnBytes;  // bytes in the last visible column
+   uint8_t shift;            // yMove & 7
+   uint8_t lowStart, lowEnd;    // rows whose shifted byte is on screen
+   uint8_t highStart, highEnd;  // rows whose spill into the next page is on screen
+};
+
+#ifdef OLEDDISPLAY_GLYPH_CACHE
+// A glyph of the font `font` shifted down by `shift` rows: `bands` bytes per
+// column, byte b of a column lands on page (y >> 3) + b
+struct OLEDGlyph
+{
+   const char *font;
+   uint8_t advance;  // cursor advance, there may be fewer columns
+   uint8_t height;   // font height, culled like drawInternal() does
+   uint8_t columns;  // 0 for glyphs without pixels
+   uint8_t bands;
+   uint8_t data[OLEDDISPLAY_GLYPH_CACHE_BYTES];
+};
+#endif
+
+// Decodes a glyph of a FONT_RLE font one column at a time. The pixels go
+// down the columns and on into the next one, as runs of alternating color
+// (starting with off) whose lengths are nibbles: 15 continues the run
+struct OLEDRleGlyph
+{
+   const char *data;
+   const char *end;
+   uint8_t height;
+   bool lowNibble;
+   uint8_t color;  // of the current run
+   uint16_t run;   // pixels left in it
+
+   OLEDRleGlyph(const char *data, uint8_t size, uint8_t height)
+       : data(data), end(data + size), height(height), lowNibble(false), color(1), run(0)
+   {
+   }
+
+   inline void nextRun()
+   {
+      uint8_t nibble;
+      color ^= 1;
+      do
+      {
+         nibble    = lowNibble ? pgm_read_byte(data++) & 0x0F : pgm_read_byte(data) >> 4;
+         lowNibble = !lowNibble;
+         run += nibble;
+      } while (nibble == 15 && data < end);
+   }
+
+   // Decodes the next column into rows[0, (height + 7) / 8), false once all
+   // pixels are out (the remaining columns are empty)
+   inline bool column(uint8_t *rows)
+   {
+      if (run == 0 && data == end) return false;
+      memset(rows, 0, (height + 7) >> 3);
+      uint8_t y = 0;
+      while (y < height)
+      {
+         if (run == 0)
+         {
+            if (data == end) break;
+            nextRun();
+            continue;
+         }
+         uint8_t take = min(run, (uint16_t)(height - y));
+         run -= take;
+         if (!color)
+         {
+            y += take;
+            continue;
+         }
+         while (take)
+         {
+            uint8_t bit  = y & 7;
+            uint8_t bits = min(take, (uint8_t)(8 - bit));
+            rows[y >> 3] |= (uint8_t)(0xFF >> (8 - bits)) << bit;
+            y += bits;
+            take -= bits;
+         }
+      }
+      return true;
+   }
+};
+
+// The column runs of the midpoint circle of `radius` (0 for an unused slot
+// of the cache). Column c = 1..radius right of the centre holds the outline
+// rows outlineLow[c] to outlineHigh[c] below the centre, mirrored into the
+// other quadrants, without the 4 pixels on the axes. fillCircle() covers
+// rows -fillHeight[m] to fillHeight[m] of the columns -m and m - 1. From
+// radius 2 on every one of these is a single run
+struct OLEDCircleSpans
+{
+   int16_t radius;
+   uint8_t outlineLow[OLEDDISPLAY_CIRCLE_SPAN_RADIUS + 1];
+   uint8_t outlineHigh[OLEDDISPLAY_CIRCLE_SPAN_RADIUS + 1];
+   uint8_t fillHeight[OLEDDISPLAY_CIRCLE_SPAN_RADIUS + 1];
+
+   void build(int16_t r)
+   {
+      radius = r;
+      memset(outlineLow, 0xFF, sizeof(outlineLow));
+      memset(outlineHigh, 0, sizeof(outlineHigh));
+      memset(fillHeight, 0, sizeof(fillHeight));
+
+      int16_t x = 0, y = r;
+      int16_t dp = 1 - r;
+      do
+      {
+         if (dp < 0)
+            dp = dp + 2 * (++x) + 3;
+         else
+            dp = dp + 2 * (++x) - 2 * (--y) + 5;
+
+         addOutline(x, y);
+         addOutline(y, x);
+         // The rows of fillCircle() at +-y span -x..x-1, the ones at +-x span -y..y-1
+         if (fillHeight[x] < y) fillHeight[x] = y;
+         if (fillHeight[y] < x) fillHeight[y] = x;
+      } while (x < y);
+
+      // A row reaches all columns up to its half width
+      for (int16_t m = r - 1; m > 0; m--)
+      {
+         if (fillHeight[m] < fillHeight[m + 1]) fillHeight[m] = fillHeight[m + 1];
+      }
+   }
+
+   void addOutline(int16_t column, int16_t row)
+   {
+      if (row < outlineLow[column]) outlineLow[column] = row;
+      if (row > outlineHigh[column]) outlineHigh[column] = row;
+   }
+};
+
+// One address window of a flush: the addressing commands (DC low) followed
+// by a run of framebuffer bytes (DC high), see OLEDDisplay::nextFlushStep()
+struct OLEDFlushStep
+{
+   uint8_t commands[6];
+   uint8_t commandLength;
+   uint16_t dataStart;
+   uint16_t dataLength;
+};
+
+// Called when displayAsync() has sent the last byte, from the interrupt
+typedef void (*OLEDFlushCallback)(void);
+
+// The screen size the pixel, line, rectangle and circle functions clip
+// against and index with, as set by setScreenSize()
+struct OLEDScreen
+{
+   uint8_t width, height;
+};
+
+// The same fixed at compile time, the compiler turns the bounds into
+// immediates and the page stride into a shift (see OLEDDisplayStatic.h)
+template <uint8_t W, uint8_t H>
+struct OLEDFixedScreen
+{
+   static constexpr uint8_t width  = W;
+   static constexpr uint8_t height = H;
+};
+
+template <uint8_t W, uint8_t H>
+constexpr uint8_t OLEDFixedScreen<W, H>::width;
+template <uint8_t W, uint8_t H>
+constexpr uint8_t OLEDFixedScreen<W, H>::height;
+
+// An entry of the OLEDDISPLAY_DISPLAY_LIST is the op, its int16_t arguments
+// (little endian, oledListArgs[op] of them) and the pointer or text
+enum OLEDListOp
+{
+   OLED_LIST_COLOR,         // color
+   OLED_LIST_FONT,          // font pointer
+   OLED_LIST_FONT_SCALE,    // scale
+   OLED_LIST_PIXEL,         // x, y
+   OLED_LIST_LINE,          // x0, y0, x1, y1
+   OLED_LIST_RECT,          // x, y, width, height
+   OLED_LIST_FILL_RECT,     // x, y, width, height
+   OLED_LIST_CIRCLE,        // x, y, radius
+   OLED_LIST_CIRCLE_QUADS,  // x, y, radius, quads
+   OLED_LIST_FILL_CIRCLE,   // x, y, radius
+   OLED_LIST_HLINE,         // x, y, length
+   OLED_LIST_VLINE,         // x, y, length
+   OLED_LIST_IMAGE,         // x, y, width, height, image pointer
+   OLED_LIST_XBM,           // x, y, width, height, xbm pointer
+   OLED_LIST_ROUND_RECT,    // x, y, width, height, radius
+   OLED_LIST_FILL_ROUND_RECT,  // x, y, width, height, radius
+   OLED_LIST_TEXT,          // x, y, length, UTF-8 text of one aligned line
+   OLED_LIST_CODES          // x, y, length, font codes (the log buffer)
+};
+
+#ifdef OLEDDISPLAY_DISPLAY_LIST
+const uint8_t oledListArgs[] PROGMEM = {1, 0, 1, 2, 4, 4, 4, 3, 4, 3, 3, 3, 4, 4, 5, 5, 3, 3};
+#endif
+
+// Incremental form of OLEDDisplay::utf8ascii(): feed the UTF-8 bytes in
+// order, next() returns the font code or 0 for a byte that has to be skipped
+struct OLEDUtf8Decoder
+{
+   uint8_t last;
+
+   OLEDUtf8Decoder() : last(0) {}
+
+   inline uint8_t next(uint8_t ascii)
+   {
+      if (ascii < 128)
+      {  // Standard ASCII-set 0..0x7F handling
+         last = 0;
+         return ascii;
+      }
+
+      uint8_t lead = last;
+      last         = ascii;
+
+      switch (lead)
+      {  // conversion depnding on first UTF8-character
+         case 0xC2:
+            return ascii;
+         case 0xC3:
+            return ascii | 0xC0;
+         case 0x82:
+            if (ascii == 0xAC) return 0x80;  // special case Euro-symbol
+      }
+      return 0;
+   }
+};
+
+// One line of wrapped text from OLEDDisplay::layoutText(): `length` bytes of
+// the text starting at `offset`, `width` pixels wide
+struct OLEDTextLine
+{
+   uint16_t offset;
+   uint16_t length;
+   uint16_t width;
+};
+
+// Advance widths of a font copied out of its jump table, advance[i] is the
+// one of font code firstChar + i for the first `count` codes of the font.
+// Gaps of the font hold 0
+struct OLEDFontMetrics
+{
+   const char *font;  // the font the table was built for
+   uint8_t scale;     // and the font scale the advances are multiplied by
+   uint8_t maxAdvance;
+   uint8_t firstChar;
+   uint8_t count;
+   uint8_t charNum;   // of the font, codes past `count` are looked up there
+   uint8_t advance[OLEDDISPLAY_FONT_METRICS_CHARS];
+};
+
+template <OLEDDISPLAY_COLOR color>
+inline void oledBlitByte(uint8_t &target, uint8_t bits);
+
+template <>
+inline void oledBlitByte<WHITE>(uint8_t &target, uint8_t bits) { target |= bits; }
+
+template <>
+inline void oledBlitByte<BLACK>(uint8_t &target, uint8_t bits) { target &= ~bits; }
+
+template <>
+inline void oledBlitByte<INVERSE>(uint8_t &target, uint8_t bits) { target ^= bits; }
+
+// Bit n of a byte spread to bits [2n, 2n + 2), and of a nibble to bits
+// [3n, 3n + 3). 2x is the common case and gets the whole byte
+const uint16_t oledScale2[256] PROGMEM = {
+    0x0000, 0x0003, 0x000C, 0x000F, 0x0030, 0x0033, 0x003C, 0x003F,
+    0x00C0, 0x00C3, 0x00CC, 0x00CF, 0x00F0, 0x00F3, 0x00FC, 0x00FF,
+    0x0300, 0x0303, 0x030C, 0x030F, 0x0330, 0x0333, 0x033C, 0x033F,
+    0x03C0, 0x03C3, 0x03CC, 0x03CF, 0x03F0, 0x03F3, 0x03FC, 0x03FF,
+    0x0C00, 0x0C03, 0x0C0C, 0x0C0F, 0x0C30, 0x0C33, 0x0C3C, 0x0C3F,
+    0x0CC0, 0x0CC3, 0x0CCC, 0x0CCF, 0x0CF0, 0x0CF3, 0x0CFC, 0x0CFF,
+    0x0F00, 0x0F03, 0x0F0C, 0x0F0F, 0x0F30, 0x0F33, 0x0F3C, 0x0F3F,
+    0x0FC0, 0x0FC3, 0x0FCC, 0x0FCF, 0x0FF0, 0x0FF3, 0x0FFC, 0x0FFF,
+    0x3000, 0x3003, 0x300C, 0x300F, 0x3030, 0x3033, 0x303C, 0x303F,
+    0x30C0, 0x30C3, 0x30CC, 0x30CF, 0x30F0, 0x30F3, 0x30FC, 0x30FF,
+    0x3300, 0x3303, 0x330C, 0x330F, 0x3330, 0x3333, 0x333C, 0x333F,
+    0x33C0, 0x33C3, 0x33CC, 0x33CF, 0x33F0, 0x33F3, 0x33FC, 0x33FF,
+    0x3C00, 0x3C03, 0x3C0C, 0x3C0F, 0x3C30, 0x3C33, 0x3C3C, 0x3C3F,
+    0x3CC0, 0x3CC3, 0x3CCC, 0x3CCF, 0x3CF0, 0x3CF3, 0x3CFC, 0x3CFF,
+    0x3F00, 0x3F03, 0x3F0C, 0x3F0F, 0x3F30, 0x3F33, 0x3F3C, 0x3F3F,
+    0x3FC0, 0x3FC3, 0x3FCC, 0x3FCF, 0x3FF0, 0x3FF3, 0x3FFC, 0x3FFF,
+    0xC000, 0xC003, 0xC00C, 0xC00F, 0xC030, 0xC033, 0xC03C, 0xC03F,
+    0xC0C0, 0xC0C3, 0xC0CC, 0xC0CF, 0xC0F0, 0xC0F3, 0xC0FC, 0xC0FF,
+    0xC300, 0xC303, 0xC30C, 0xC30F, 0xC330, 0xC333, 0xC33C, 0xC33F,
+    0xC3C0, 0xC3C3, 0xC3CC, 0xC3CF, 0xC3F0, 0xC3F3, 0xC3FC, 0xC3FF,
+    0xCC00, 0xCC03, 0xCC0C, 0xCC0F, 0xCC30, 0xCC33, 0xCC3C, 0xCC3F,
+    0xCCC0, 0xCCC3, 0xCCCC, 0xCCCF, 0xCCF0, 0xCCF3, 0xCCFC, 0xCCFF,
+    0xCF00, 0xCF03, 0xCF0C, 0xCF0F, 0xCF30, 0xCF33, 0xCF3C, 0xCF3F,
+    0xCFC0, 0xCFC3, 0xCFCC, 0xCFCF, 0xCFF0, 0xCFF3, 0xCFFC, 0xCFFF,
+    0xF000, 0xF003, 0xF00C, 0xF00F, 0xF030, 0xF033, 0xF03C, 0xF03F,
+    0xF0C0, 0xF0C3, 0xF0CC, 0xF0CF, 0xF0F0, 0xF0F3, 0xF0FC, 0xF0FF,
+    0xF300, 0xF303, 0xF30C, 0xF30F, 0xF330, 0xF333, 0xF33C, 0xF33F,
+    0xF3C0, 0xF3C3, 0xF3CC, 0xF3CF, 0xF3F0, 0xF3F3, 0xF3FC, 0xF3FF,
+    0xFC00, 0xFC03, 0xFC0C, 0xFC0F, 0xFC30, 0xFC33, 0xFC3C, 0xFC3F,
+    0xFCC0, 0xFCC3, 0xFCCC, 0xFCCF, 0xFCF0, 0xFCF3, 0xFCFC, 0xFCFF,
+    0xFF00, 0xFF03, 0xFF0C, 0xFF0F, 0xFF30, 0xFF33, 0xFF3C, 0xFF3F,
+    0xFFC0, 0xFFC3, 0xFFCC, 0xFFCF, 0xFFF0, 0xFFF3, 0xFFFC, 0xFFFF};
+const uint16_t oledScale3[16] PROGMEM = {0x000, 0x007, 0x038, 0x03F, 0x1C0, 0x1C7, 0x1F8, 0x1FF,
+                                         0xE00, 0xE07, 0xE38, 0xE3F, 0xFC0, 0xFC7, 0xFF8, 0xFFF};
+
+// Stretches a column of `bytes` rows to 2 or 3 times its height, byte i of
+// the source becomes the bytes [i * scale, (i + 1) * scale) of `target`
+inline void oledScaleColumn(uint8_t *target, const uint8_t *rows, uint8_t bytes, uint8_t scale)
+{
+   if (scale == 2)
+   {
+      for (uint8_t i = 0; i < bytes; i++)
+      {
+         uint16_t bits = pgm_read_word(oledScale2 + rows[i]);
+         *target++     = bits;
+         *target++     = bits >> 8;
+      }
+   }
+   else
+   {
+      for (uint8_t i = 0; i < bytes; i++)
+      {
+         uint32_t bits = pgm_read_word(oledScale3 + (rows[i] & 0x0F)) |
+                         ((uint32_t)pgm_read_word(oledScale3 + (rows[i] >> 4)) << 12);
+         *target++ = bits;
+         *target++ = bits >> 8;
+         *target++ = bits >> 16;
+      }
+   }
+}
+
+#ifdef OLEDDISPLAY_GLYPH_CACHE
+// Copy the bands [firstBand, endBand) of `columns` cached glyph columns,
+// `target` is the first column on page firstBand
+template <OLEDDISPLAY_COLOR color>
+inline void oledBlitGlyph(uint8_t *target, uint16_t stride, const uint8_t *source, uint8_t bands,
+                          int16_t columns, uint8_t firstBand, uint8_t endBand)
+{
+   for (uint8_t band = firstBand; band < endBand; band++)
+   {
+      const uint8_t *column = source + band;
+      for (int16_t x = 0; x < columns; x++)
+      {
+         oledBlitByte<color>(target[x], *column);
+         column += bands;
+      }
+      target += stride;
+   }
+}
+#endif
+
 class OLEDDisplay : public Print
 {
   public:
@@ -181,8 +683,15 @@ class OLEDDisplay : public Print
    // Draw a lin vertically
    void drawVerticalLine(int16_t x, int16_t y, int16_t length);
 
-   // Draws a rounded progress bar with the outer dimensions given by width and
-   // height. Progress is
+   // Draw the border of a rectangle whose corners are quarter circles of
+   // radius (at most half the shorter side)
+   void drawRoundRect(int16_t x, int16_t y, int16_t width, int16_t height, int16_t radius);
+
+   // Fill the rounded rectangle
+   void fillRoundRect(int16_t x, int16_t y, int16_t width, int16_t height, int16_t radius);
+
+   // Draws a rounded progress bar, the border spans columns x to x + width
+   // and rows y to y + height. Progress is
    // a unsigned byte value between 0 and 100
    void drawProgressBar(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t progress);
 
@@ -194,20 +703,44 @@ class OLEDDisplay : public Print
 
    /* Text functions */
 
-   // Draws a string at the given location
-   void drawString(int16_t x, int16_t y, String text);
+   // Draws a string at the given location. The text is UTF-8, it is decoded
+   // while drawing, so nothing is copied or allocated
+   void drawString(int16_t x, int16_t y, const char *text, uint16_t length);
+   void drawString(int16_t x, int16_t y, const char *text);
+   void drawString(int16_t x, int16_t y, const String &text);
 
    // Draws a String with a maximum width at the given location.
    // If the given String is wider than the specified width
    // The text will be wrapped to the next line at a space or dash
-   void drawStringMaxWidth(int16_t x, int16_t y, uint16_t maxLineWidth, String text);
-
-   // Returns the width of the const char* with the current
-   // font settings
+   // (see layoutText())
+   void drawStringMaxWidth(int16_t x, int16_t y, uint16_t maxLineWidth, const char *text,
+                           uint16_t length);
+   void drawStringMaxWidth(int16_t x, int16_t y, uint16_t maxLineWidth, const char *text);
+   void drawStringMaxWidth(int16_t x, int16_t y, uint16_t maxLineWidth, const String &text);
+
+   // Returns the width of the UTF-8 text with the current
+   // font settings, the widest line if it contains '\n'
    uint16_t getStringWidth(const char *text, uint16_t length);
+   uint16_t getStringWidth(const char *text);
 
    // Convencience method for the const char version
-   uint16_t getStringWidth(String text);
+   uint16_t getStringWidth(const String &text);
+
+   // Width of the widest character of the current font
+   uint8_t getMaxCharWidth();
+
+   // Wraps UTF-8 text to maxLineWidth with the current font in one pass and
+   // stores the first maxLines lines. Lines end at '\n', after a dash or
+   // before a space (the space is dropped). A word wider than maxLineWidth
+   // is cut before the character that doesn't fit. Returns the number of
+   // lines the whole text needs, which can be more than maxLines
+   uint16_t layoutText(const char *text, uint16_t length, uint16_t maxLineWidth,
+                       OLEDTextLine *lines, uint16_t maxLines);
+
+   // Draws lines of `text` laid out by layoutText() with the same font, the
+   // first one at (x, y). Keep the lines to redraw or scroll the text
+   void drawTextLayout(int16_t x, int16_t y, const char *text, const OLEDTextLine *lines,
+                       uint16_t lineCount);
 
    // Specifies relative to which anchor point
    // the text is rendered. Available constants:
@@ -219,6 +752,22 @@ class OLEDDisplay : public Print
    // ArialMT_Plain_10, ArialMT_Plain_16, ArialMT_Plain_24
    void setFont(const char *fontData);
 
+   // Draws and measures text at 1, 2 or 3 times the size of the font, every
+   // pixel becomes a square. A small font can stand in for a big one this
+   // way, ArialMT_Plain_10 at 2 for ArialMT_Plain_24 for example
+   void setFontScale(uint8_t scale);
+   uint8_t getFontScale() { return fontScale; }
+
+#ifdef OLEDDISPLAY_GLYPH_CACHE
+   // Glyph cache lookups of drawString() since the last reset
+   uint32_t getGlyphCacheHits() { return glyphCacheHits; }
+   uint32_t getGlyphCacheMisses() { return glyphCacheMisses; }
+   void resetGlyphCacheStats();
+
+   // Forget all cached glyphs
+   void clearGlyphCache();
+#endif
+
    /* Display functions */
 
    // Turn the display on
@@ -245,31 +794,76 @@ class OLEDDisplay : public Print
    // Turn the display upside down
    void flipScreenVertically();
 
-   // Write the buffer to the display memory
+   // The panel has 64 rows of GRAM, a display less high doesn't show them
+   // all. Show GRAM row `line` (0..63) at the top, the rows wrap around
+   void setStartLine(uint8_t line);
+
+   // Write the buffer to GRAM from page `page` on (0 by default), e.g. to
+   // the rows setStartLine() can scroll in. The dirty spans don't know which
+   // pages the panel shows, call invalidate() when switching back
+   void setGramPage(uint8_t page) { gramPage = page; }
+
+   // Write the buffer to the display memory. Only the column span of every
+   // page touched by a draw call (or lit before the last clear()) is sent
    void display(void);
 
+   // Start writing the buffer and return at once, `callback` runs from the
+   // transport interrupt after the last byte. Don't draw until then. Without
+   // interrupt support (see OLEDDISPLAY_ASYNC_TRANSPORT) this is display()
+   // followed by the callback
+   void displayAsync(OLEDFlushCallback callback);
+
+   // True while a displayAsync() flush is running
+   bool displayBusy();
+
+   // Advances displayAsync(), called by the transport interrupt handler each
+   // time a byte has been shifted out
+   void asyncInterrupt();
+
    // Clear the local pixel buffer
    void clear(void);
 
+#ifdef OLEDDISPLAY_DISPLAY_LIST
+   // Bytes of the display list the frame takes so far, and whether draw
+   // calls were dropped since clear() because it was full
+   uint16_t getDisplayListLength() { return displayListLength; }
+   bool displayListFull() { return displayListOverflow; }
+#endif
+
    // Log buffer implementation
 
    // This will define the lines and characters you can
    // print to the screen. When you exeed the buffer size (lines * chars)
-   // the output may be truncated due to the size constraint.
+   // the oldest line is dropped, a single line longer than the buffer
+   // keeps its end. Costs lines * 2 bytes more for the line index
    bool setLogBuffer(uint16_t lines, uint16_t chars);
 
-   // Draw the log buffer at position (x, y)
+   // Draw the log buffer at position (x, y), the lines below the screen
+   // are skipped
    void drawLogBuffer(uint16_t x, uint16_t y);
 
-   // Implementent needed function to be compatible with Print class
+   // Implementent needed function to be compatible with Print class. Every
+   // char is appended in constant time, print() comes in through the bulk
+   // write without a virtual call per char
    size_t write(uint8_t c);
+   size_t write(const uint8_t *data, size_t length);
    size_t write(const char *s);
 
+   // Send the whole buffer on the next display(). The draw functions keep
+   // track of what they touched, call this after writing to `buffer` directly
+   void invalidate();
+   // The same for just the pixels in a box, it is also cleared by clear()
+   void invalidate(int16_t x, int16_t y, int16_t width, int16_t height);
+
    uint8_t *buffer;
 
 #ifdef OLEDDISPLAY_DOUBLE_BUFFER
    uint8_t *buffer_back;
 #endif
+#ifdef OLEDDISPLAY_PAGE_HASH
+   // Hash of every OLEDDISPLAY_PAGE_HASH_SEGMENT columns of a page as last sent
+   uint32_t *page_hashes;
+#endif
 
   protected:
    uint8_t _address;
@@ -282,14 +876,53 @@ class OLEDDisplay : public Print
    OLEDDISPLAY_TEXT_ALIGNMENT textAlignment = TEXT_ALIGN_LEFT;
    OLEDDISPLAY_COLOR color                  = WHITE;
 
-   const char *fontData = ArialMT_Plain_10;
+   const char *fontData = OLEDDISPLAY_DEFAULT_FONT;
+   uint8_t fontScale    = 1;
+   OLEDFontMetrics fontMetrics = {};
+
+#ifdef OLEDDISPLAY_GLYPH_CACHE
+   // The lookup only scans the keys (code, shift and the low bits of the
+   // font address, 0 for an unused slot), the font is checked on a match
+   uint32_t glyphCacheKeys[OLEDDISPLAY_GLYPH_CACHE];
+   uint32_t glyphCacheLastUse[OLEDDISPLAY_GLYPH_CACHE];
+   OLEDGlyph glyphCache[OLEDDISPLAY_GLYPH_CACHE];
+   uint32_t glyphCacheClock  = 0;
+   uint32_t glyphCacheHits   = 0;
+   uint32_t glyphCacheMisses = 0;
+#endif
+
+#ifdef OLEDDISPLAY_DISPLAY_LIST
+   uint8_t displayList[OLEDDISPLAY_DISPLAY_LIST];
+   uint16_t displayListLength = 0;
+   bool displayListOverflow   = false;
+   // Set while display() replays the list, the draw functions draw then
+   bool displayListReplay = false;
+   // The state at clear(), the replay of every page starts from it
+   OLEDDISPLAY_COLOR listColor = WHITE;
+   const char *listFont        = OLEDDISPLAY_DEFAULT_FONT;
+   uint8_t listFontScale       = 1;
+#endif
+
+#ifdef OLEDDISPLAY_CIRCLE_SPAN_CACHE
+   // The span tables circleSpans() built last, circleSpansNext is replaced next
+   OLEDCircleSpans circleSpanCache[2] = {};
+   uint8_t circleSpansNext             = 0;
+#endif
 
-   // State values for logBuffer
+   // State values for logBuffer: a ring of logBufferSize font codes with
+   // the oldest of logBufferFilled at logBufferStart. The ring indices where
+   // the logBufferLine lines after the first one begin are a ring of
+   // logBufferMaxLines entries in logBufferLineStarts (one allocation with
+   // logBuffer), the oldest at logBufferFirstLine
    uint16_t logBufferSize            = 0;
    uint16_t logBufferFilled          = 0;
+   uint16_t logBufferStart           = 0;
    uint16_t logBufferLine            = 0;
    uint16_t logBufferMaxLines        = 0;
+   uint16_t logBufferFirstLine       = 0;
+   uint16_t *logBufferLineStarts     = NULL;
    char *logBuffer                   = NULL;
+   OLEDUtf8Decoder logBufferDecoder;
    const uint8_t TRANSFER_BLOCK_SIZE = 16;
 
    uint8_t display_mode;
@@ -297,15 +930,177 @@ class OLEDDisplay : public Print
    uint8_t _display_width, _display_height;
    uint16_t _display_buffer_size;
 
+   // Per page column span written since the last display() (dirty) and the
+   // span that may hold lit pixels since the last clear() (ink), min > max
+   // means none
+   uint8_t dirtyMinX[OLEDDISPLAY_MAX_PAGES];
+   uint8_t dirtyMaxX[OLEDDISPLAY_MAX_PAGES];
+   uint8_t inkMinX[OLEDDISPLAY_MAX_PAGES];
+   uint8_t inkMaxX[OLEDDISPLAY_MAX_PAGES];
+   // The panel content is unknown, send the dirty spans without narrowing them
+   bool fullFlush = true;
+   // GRAM page the buffer starts at, see setGramPage()
+   uint8_t gramPage = 0;
+
+   // `buffer` (and buffer_back or page_hashes) belong to a subclass, see
+   // OLEDDisplayStatic.h. init() doesn't allocate them and end() doesn't free
+   // them then
+   bool staticBuffers = false;
+   // malloc() the buffers for the current screen size
+   bool allocateBuffers();
+
+   // Widen the dirty span (and unless drawing BLACK the ink span) of pages
+   // firstPage to lastPage to cover columns minX to maxX
+   void markDirty(uint8_t firstPage, uint8_t lastPage, uint8_t minX, uint8_t maxX);
+
    // Send a command to the display (low level function)
    void sendCommand(uint8_t com);
+   // Send a list of commands (and their arguments) in one chip select window
+   // or I2C transaction, keep it below the 32 byte Wire buffer
+   void sendCommands(const uint8_t *commands, uint8_t length);
+   // Send the address commands and the data of one flush step. SPI does both
+   // under one chip select and flips DC once in between
+   void sendFlushStep(const OLEDFlushStep &step);
    void sendData(uint8_t data, uint16_t len);
    void sendData(uint8_t *data, uint16_t startIdx, uint16_t len);
    void rawDataWrite(uint8_t c);
    void startDataWrite();
    void endDataWrite();
-   void displayPaged(uint8_t minBoundX, uint8_t maxBoundX, uint8_t minBoundY, uint8_t maxBoundY);
-   void displayNormal(uint8_t minBoundX, uint8_t maxBoundX, uint8_t minBoundY, uint8_t maxBoundY);
+   // Apply a page mask in the current color to a run of framebuffer bytes
+   void fillPageRun(uint8_t *bufferPtr, uint16_t length, uint8_t mask);
+
+   // The pixel, line, rectangle and circle functions for a screen of
+   // screen.width x screen.height. The public ones pass runtimeScreen(),
+   // OLEDDisplayStatic an OLEDFixedScreen
+   OLEDScreen runtimeScreen() { return OLEDScreen{_display_width, _display_height}; }
+   template <class Screen>
+   void setPixel(const Screen &screen, int16_t x, int16_t y);
+   template <class Screen>
+   void drawLine(const Screen &screen, int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+   template <class Screen>
+   void drawRect(const Screen &screen, int16_t x, int16_t y, int16_t width, int16_t height);
+   template <class Screen>
+   void fillRect(const Screen &screen, int16_t x, int16_t y, int16_t width, int16_t height);
+   template <class Screen>
+   void drawCircle(const Screen &screen, int16_t x0, int16_t y0, int16_t radius);
+   template <class Screen>
+   void drawCircleQuads(const Screen &screen, int16_t x0, int16_t y0, int16_t radius, uint8_t quads);
+   template <class Screen>
+   void fillCircle(const Screen &screen, int16_t x0, int16_t y0, int16_t radius);
+   template <class Screen>
+   void drawHorizontalLine(const Screen &screen, int16_t x, int16_t y, int16_t length);
+   template <class Screen>
+   void drawVerticalLine(const Screen &screen, int16_t x, int16_t y, int16_t length);
+   template <class Screen>
+   void drawRoundRect(const Screen &screen, int16_t x, int16_t y, int16_t width, int16_t height,
+                      int16_t radius);
+   template <class Screen>
+   void fillRoundRect(const Screen &screen, int16_t x, int16_t y, int16_t width, int16_t height,
+                      int16_t radius);
+
+   // drawHorizontalLine() and drawVerticalLine() in parts: clip the run to
+   // the screen (false if nothing is left), write a clipped run, and
+   // fillRow()/fillColumn() to clip and write without marking anything
+   // dirty. The span functions mark the box of the whole shape once with
+   // markDirtyBox() (false if it is off screen)
+   template <class Screen>
+   bool clipRow(const Screen &screen, int16_t &x, int16_t y, int16_t &length);
+   template <class Screen>
+   void writeRow(const Screen &screen, int16_t x, int16_t y, int16_t length);
+   template <class Screen>
+   void fillRow(const Screen &screen, int16_t x, int16_t y, int16_t length);
+   template <class Screen>
+   bool clipColumn(const Screen &screen, int16_t x, int16_t &y, int16_t &length);
+   template <class Screen>
+   void writeColumn(const Screen &screen, int16_t x, int16_t y, int16_t length);
+   template <class Screen>
+   void fillColumn(const Screen &screen, int16_t x, int16_t y, int16_t length);
+   template <class Screen>
+   bool markDirtyBox(const Screen &screen, int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+   // The span table of a circle, built into `scratch` unless it is cached.
+   // NULL below radius 2 (the octants meet on the axes there) and above
+   // OLEDDISPLAY_CIRCLE_SPAN_RADIUS
+   const OLEDCircleSpans *circleSpans(int16_t radius, OLEDCircleSpans &scratch);
+   // The outline quadrants `quads` (bits as drawCircleQuads()) around the
+   // centres left/top, right/top, left/bottom and right/bottom, in column
+   // runs where the outline is steep and row runs where it is flat
+   template <class Screen>
+   void drawCircleSpans(const Screen &screen, const OLEDCircleSpans &spans, uint8_t quads,
+                        int16_t left, int16_t top, int16_t right, int16_t bottom);
+   // The radius of the corners of a width x height rounded rectangle
+   int16_t cornerRadius(int16_t width, int16_t height, int16_t radius);
+
+   // Narrow the dirty spans for the change detection mode and plan the
+   // address windows, then hand out one window per nextFlushStep() call
+   void prepareFlush();
+   bool nextFlushStep(OLEDFlushStep &step);
+   // The address commands of a step sending columns minX to maxX of pages
+   // firstPage to lastPage (PAGED mode sends one page per step)
+   void addressFlushStep(OLEDFlushStep &step, uint8_t firstPage, uint8_t lastPage, uint8_t minX,
+                         uint8_t maxX);
+#ifdef OLEDDISPLAY_PAGE_HASH
+   // Narrow the dirty span of `page` to the segments of pageData whose hash
+   // changed since they were last sent
+   void hashDirtySpan(uint8_t page, const uint8_t *pageData);
+#endif
+   // Pages flushWindowFirst to flushWindowLast share one address window in
+   // NORMAL mode (first > last if every page gets its own), flushPage is the
+   // next page nextFlushStep() looks at
+   uint8_t flushWindowFirst, flushWindowLast, flushPage;
+
+#ifdef OLEDDISPLAY_ASYNC_TRANSPORT
+   // displayAsync() state, walked by asyncFill() from the interrupt
+   OLEDFlushStep asyncStep;
+   uint16_t asyncIndex;           // next byte of asyncStep, commands first
+   volatile uint8_t asyncInFlight;  // bytes handed to the transmitter, at most 2
+   uint8_t asyncPending;          // next byte, held back until DC may change
+   bool asyncPendingIsData;
+   bool asyncPendingValid;
+   bool asyncIsData;              // current level of DC
+   OLEDFlushCallback asyncCallback;
+   volatile bool asyncBusy = false;
+
+   bool asyncNextByte(uint8_t &value, bool &isData);
+   void asyncFill();
+
+   // Implemented by the transport: select the panel with the interrupt
+   // still masked, unmask it once both TXD stages are loaded, set DC, load a
+   // byte into the transmitter, and deselect and disable the interrupt again
+   void asyncStart();
+   void asyncEnableInterrupt();
+   void asyncSetDC(bool isData);
+   void asyncTransmit(uint8_t value);
+   void asyncFinish();
+#endif
+   // Send length bytes of the buffer starting at start as display data in
+   // TRANSFER_BLOCK_SIZE transactions, for the I2C transports
+   void sendBufferChunks(uint16_t start, uint16_t length);
+
+   // With OLEDDISPLAY_DISPLAY_LIST a draw function hands its arguments (and
+   // the `length` bytes at `data`) to recordData() first and returns if that
+   // is true, which it is unless display() is replaying the list. Without it
+   // this is false and compiles away
+#ifdef OLEDDISPLAY_DISPLAY_LIST
+   template <typename... Args>
+   bool recordData(uint8_t op, const void *data, uint16_t length, Args... args);
+
+   // display(): render every page from the list and send it
+   void flushDisplayList();
+   // Replay the list into `buffer` with the screen cut down to `page`
+   void renderPage(uint8_t page);
+#else
+   template <typename... Args>
+   bool recordData(uint8_t, const void *, uint16_t, Args...)
+   {
+      return false;
+   }
+#endif
+   template <typename... Args>
+   bool record(uint8_t op, Args... args)
+   {
+      return recordData(op, NULL, 0, args...);
+   }
 
    // virtual void sendBlockData(uint8_t com);
 
@@ -317,16 +1112,83 @@ class OLEDDisplay : public Print
    // Send all the init commands
    void sendInitCommands();
 
-   // converts utf8 characters to extended ascii
-   static char *utf8ascii(String s);
+   // converts utf8 characters to extended ascii, one byte at a time
    static byte utf8ascii(byte ascii);
 
-   void inline drawInternal(int16_t xMove, int16_t yMove, int16_t width, int16_t height,
-                            const char *data, uint16_t offset, uint16_t bytesInData)
-       __attribute__((always_inline));
+   // Append a byte to the log buffer, dropping the oldest line (or char)
+   // to make room
+   void appendLog(uint8_t c);
+   void dropLogLine();
+   // The ring index `offset` (at most logBufferSize) chars after `index`
+   uint16_t logIndex(uint16_t index, uint16_t offset)
+   {
+      index += offset;
+      return index >= logBufferSize ? index - logBufferSize : index;
+   }
+   // The entry of logBufferLineStarts for a line counted past the end
+   uint16_t logLineSlot(uint16_t line) { return line >= logBufferMaxLines ? line - logBufferMaxLines : line; }
+   // Draw `length` codes of the ring from `start`, in two parts if it wraps
+   void drawLogLine(int16_t x, int16_t y, uint16_t start, uint16_t length);
+
+   // Build fontMetrics for fontData unless it already is
+   void loadFontMetrics();
+
+   // Advance of a font code, 0 for codes the font doesn't have ('\n'
+   // included). Call loadFontMetrics() first
+   uint8_t getCharWidth(uint8_t code)
+   {
+      uint8_t index = code - fontMetrics.firstChar;
+      if (index < fontMetrics.count) return fontMetrics.advance[index];
+      if (index >= fontMetrics.charNum) return 0;
+      return pgm_read_byte(fontData + JUMPTABLE_START + index * JUMPTABLE_BYTES + JUMPTABLE_WIDTH) * fontScale;
+   }
+
+   // Line height of the current font, scaled
+   uint16_t getFontHeight() { return pgm_read_byte(fontData + HEIGHT_POS) * fontScale; }
+
+   // Clips a column-major bitmap (fonts, drawFastImage) and hands it to the
+   // blitter specialised for the current color and page alignment
+   void drawInternal(int16_t xMove, int16_t yMove, int16_t width, int16_t height,
+                     const char *data, uint16_t offset, uint16_t bytesInData);
+
+   // The same for a glyph of a FONT_RLE font, decoded column by column
+   void drawRleGlyph(int16_t xMove, int16_t yMove, int16_t width, int16_t height,
+                     const char *data, uint8_t size);
+
+   // A glyph of either kind of font at fontScale, width and height unscaled
+   void drawScaledGlyph(int16_t xMove, int16_t yMove, int16_t width, int16_t height,
+                        const char *data, uint8_t size, bool rle);
+
+   // Clipping, dirty tracking and targets of drawInternal(), everything but
+   // blit.source. False if nothing is on screen
+   bool setupBlit(OLEDBlit &blit, int16_t xMove, int16_t yMove, int16_t width, int16_t height,
+                  uint16_t bytesInData);
+   void runBlit(const OLEDBlit &blit);
+
+   template <OLEDDISPLAY_COLOR blitColor, bool pageAligned>
+   void blitColumns(const OLEDBlit &blit);
+
+   // drawScaledGlyph() for one color and page alignment, blit is set up for
+   // the scaled size and blit.source is the glyph
+   template <OLEDDISPLAY_COLOR blitColor, bool pageAligned>
+   void blitScaled(const OLEDBlit &blit, uint8_t size, uint8_t height, bool rle);
+
+#ifdef OLEDDISPLAY_GLYPH_CACHE
+   // The glyph of `code` in the current font shifted down by `shift` rows.
+   // A miss renders it into the least recently used slot, NULL if it is too
+   // big for a slot
+   const OLEDGlyph *cacheGlyph(uint8_t code, uint8_t shift);
+   void drawGlyph(int16_t xMove, int16_t yMove, const OLEDGlyph &glyph);
+#endif
+
+   // The line breaking of layoutText(), calls emit(line) for every line
+   template <typename Emit>
+   void wrapText(const char *text, uint16_t length, uint16_t maxLineWidth, Emit emit);
 
-   void drawStringInternal(int16_t xMove, int16_t yMove, char *text, uint16_t textLength,
-                           uint16_t textWidth);
+   // Draws one line, with utf8 the text is decoded on the fly, otherwise it
+   // already holds font codes (the log buffer)
+   void drawStringInternal(int16_t xMove, int16_t yMove, const char *text, uint16_t textLength,
+                           uint16_t textWidth, bool utf8);
 };
 
 void OLEDDisplay::setScreenSize(uint8_t display_width, uint8_t display_height)
@@ -339,7 +1201,7 @@ void OLEDDisplay::setScreenSize(uint8_t display_width, uint8_t display_height)
 bool OLEDDisplay::init()
 {
    DEBUG_OLEDDISPLAY("OLEDDISPLAY_MODE = ");
-   DEBUG_OLEDDISPLAY((OLEDDISPLAY_MODE == OLEDDISPLAY_MODE_I2C)?"I2C":(OLEDDISPLAY_MODE == OLEDDISPLAY_MODE_SPI)?"SPI":"BRZO");
+   DEBUG_OLEDDISPLAY((OLEDDISPLAY_MODE == OLEDDISPLAY_MODE_I2C)?"I2C":(OLEDDISPLAY_MODE == OLEDDISPLAY_MODE_SPI)?"SPI":(OLEDDISPLAY_MODE == OLEDDISPLAY_MODE_HOST)?"HOST":"BRZO");
    DEBUG_OLEDDISPLAY("\n");
 
    DEBUG_OLEDDISPLAY("OLEDDISPLAY_CHIPSET = ");
@@ -365,7 +1227,26 @@ bool OLEDDisplay::init()
       DEBUG_OLEDDISPLAY("[OLEDDISPLAY][init] Can't establish connection to display\n");
       return false;
    }
+   if (!staticBuffers && !allocateBuffers()) return false;
+#ifdef OLEDDISPLAY_GLYPH_CACHE
+   clearGlyphCache();
+   resetGlyphCacheStats();
+#endif
+
+   sendInitCommands();
+   resetDisplay();
+
+   return true;
+}
+
+bool OLEDDisplay::allocateBuffers()
+{
+#ifdef OLEDDISPLAY_DISPLAY_LIST
+   // One page, display() renders the pages into it one after the other
+   this->buffer = (uint8_t *)malloc(sizeof(uint8_t) * _display_width);
+#else
    this->buffer = (uint8_t *)malloc(sizeof(uint8_t) * _display_buffer_size);
+#endif
    if (!this->buffer)
    {
       DEBUG_OLEDDISPLAY("[OLEDDISPLAY][init] Not enough memory to create display\n");
@@ -381,46 +1262,107 @@ bool OLEDDisplay::init()
       return false;
    }
 #endif
-
-   sendInitCommands();
-   resetDisplay();
-
+#ifdef OLEDDISPLAY_PAGE_HASH
+   this->page_hashes = (uint32_t *)malloc(sizeof(uint32_t) * (_display_height / 8) *
+                                          ((_display_width + OLEDDISPLAY_PAGE_HASH_SEGMENT - 1) / OLEDDISPLAY_PAGE_HASH_SEGMENT));
+   if (!this->page_hashes)
+   {
+      DEBUG_OLEDDISPLAY("[OLEDDISPLAY][init] Not enough memory to create page hashes\n");
+      free(this->buffer);
+      return false;
+   }
+#endif
    return true;
 }
 
 void OLEDDisplay::end()
 {
+   if (staticBuffers) return;
    if (this->buffer) free(this->buffer);
 #ifdef OLEDDISPLAY_DOUBLE_BUFFER
    if (this->buffer_back) free(this->buffer_back);
 #endif
+#ifdef OLEDDISPLAY_PAGE_HASH
+   if (this->page_hashes) free(this->page_hashes);
+#endif
 }
 
 void OLEDDisplay::resetDisplay(void)
 {
+   invalidate();
    clear();
-#ifdef OLEDDISPLAY_DOUBLE_BUFFER
-   memset(buffer_back, 1, _display_buffer_size);
-#endif
    display();
 }
 
-void OLEDDisplay::setColor(OLEDDISPLAY_COLOR color) { this->color = color; }
+void OLEDDisplay::setColor(OLEDDISPLAY_COLOR color)
+{
+   if (color != this->color) record(OLED_LIST_COLOR, color);
+   this->color = color;
+}
+
+void OLEDDisplay::invalidate()
+{
+   fullFlush = true;
+   for (uint8_t page = 0; page < OLEDDISPLAY_MAX_PAGES; page++)
+   {
+      dirtyMinX[page] = inkMinX[page] = 0;
+      dirtyMaxX[page] = inkMaxX[page] = _display_width - 1;
+   }
+}
+
+void OLEDDisplay::invalidate(int16_t x, int16_t y, int16_t width, int16_t height)
+{
+   int16_t x1 = x + width - 1;
+   int16_t y1 = y + height - 1;
+   if (x < 0) x = 0;
+   if (y < 0) y = 0;
+   if (x1 >= _display_width) x1 = _display_width - 1;
+   if (y1 >= _display_height) y1 = _display_height - 1;
+   if (x > x1 || y > y1) return;
+   // As lit, whatever the color
+   for (uint8_t page = y >> 3; page <= y1 >> 3; page++)
+   {
+      if (x < dirtyMinX[page]) dirtyMinX[page] = x;
+      if (x1 > dirtyMaxX[page]) dirtyMaxX[page] = x1;
+      if (x < inkMinX[page]) inkMinX[page] = x;
+      if (x1 > inkMaxX[page]) inkMaxX[page] = x1;
+   }
+}
+
+inline void OLEDDisplay::markDirty(uint8_t firstPage, uint8_t lastPage, uint8_t minX, uint8_t maxX)
+{
+   for (uint8_t page = firstPage; page <= lastPage; page++)
+   {
+      if (minX < dirtyMinX[page]) dirtyMinX[page] = minX;
+      if (maxX > dirtyMaxX[page]) dirtyMaxX[page] = maxX;
+      if (color == BLACK) continue;
+      if (minX < inkMinX[page]) inkMinX[page] = minX;
+      if (maxX > inkMaxX[page]) inkMaxX[page] = maxX;
+   }
+}
 
 void OLEDDisplay::setPixel(int16_t x, int16_t y)
 {
-   if (x >= 0 && x < _display_width && y >= 0 && y < _display_height)
+   if (record(OLED_LIST_PIXEL, x, y)) return;
+   setPixel(runtimeScreen(), x, y);
+}
+
+template <class Screen>
+void OLEDDisplay::setPixel(const Screen &screen, int16_t x, int16_t y)
+{
+   if (x >= 0 && x < screen.width && y >= 0 && y < screen.height)
    {
+      markDirty(y >> 3, y >> 3, x, x);
       switch (color)
       {
          case WHITE:
-            buffer[x + (y / 8) * _display_width] |= (1 << (y & 7));
+            buffer[x + (y / 8) * screen.width] |= (1 << (y & 7));
             break;
          case BLACK:
-            buffer[x + (y / 8) * _display_width] &= ~(1 << (y & 7));
+            buffer[x + (y / 8) * screen.width] &= ~(1 << (y & 7));
             break;
          case INVERSE:
-            buffer[x + (y / 8) * _display_width] ^= (1 << (y & 7));
+            buffer[x + (y / 8) * screen.width] ^= (1 << (y & 7));
             break;
       }
    }
@@ -429,7 +1371,35 @@ void OLEDDisplay::setPixel(int16_t x, int16_t y)
 // Bresenham's algorithm - thx wikipedia and Adafruit_GFX
 void OLEDDisplay::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
 {
-   int16_t steep = abs(y1 - y0) > abs(x1 - x0);
+   if (record(OLED_LIST_LINE, x0, y0, x1, y1)) return;
+   drawLine(runtimeScreen(), x0, y0, x1, y1);
+}
+
+template <class Screen>
+void OLEDDisplay::drawLine(const Screen &screen, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+   // Clamped to one past the screen so the length fits
+   if (y0 == y1)
+   {
+      int16_t left  = x0 < x1 ? x0 : x1;
+      int16_t right = x0 < x1 ? x1 : x0;
+      if (left < -1) left = -1;
+      if (right > screen.width) right = screen.width;
+      drawHorizontalLine(screen, left, y0, right - left + 1);
+      return;
+   }
+   if (x0 == x1)
+   {
+      int16_t top    = y0 < y1 ? y0 : y1;
+      int16_t bottom = y0 < y1 ? y1 : y0;
+      if (top < -1) top = -1;
+      if (bottom > screen.height) bottom = screen.height;
+      drawVerticalLine(screen, x0, top, bottom - top + 1);
+      return;
+   }
+
+   // x is the major axis from here on, a screen row for steep lines
+   bool steep = abs(y1 - y0) > abs(x1 - x0);
    if (steep)
    {
       _swap_int16_t(x0, y0);
@@ -442,136 +1412,319 @@ void OLEDDisplay::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
       _swap_int16_t(y0, y1);
    }
 
-   int16_t dx, dy;
-   dx = x1 - x0;
-   dy = abs(y1 - y0);
-
-   int16_t err = dx / 2;
-   int16_t ystep;
-
-   if (y0 < y1)
+   uint32_t dx    = x1 - x0;
+   uint32_t dy    = abs(y1 - y0);
+   uint32_t half  = dx / 2;
+   int16_t ystep  = y0 < y1 ? 1 : -1;
+   int16_t xLimit = (steep ? screen.height : screen.width) - 1;
+   int16_t yLimit = (steep ? screen.width : screen.height) - 1;
+
+   // The error starts at dx / 2 and y steps when it drops below 0, so the
+   // pixel k steps along x lies ceil((k * dy - dx / 2) / dx) steps along y.
+   // Solving that for the screen edges clips the line before drawing it
+   // (Liang-Barsky on Bresenham's integer grid), the pixels stay the same
+   auto ySteps = [&](uint32_t k) -> uint32_t {
+      return k * dy <= half ? 0 : (k * dy - half + dx - 1) / dx;
+   };
+
+   if (x1 < 0 || x0 > xLimit) return;
+   uint32_t first = x0 < 0 ? -x0 : 0;
+   uint32_t last  = x1 > xLimit ? xLimit - x0 : dx;
+   int32_t stepsLow  = ystep > 0 ? -y0 : y0 - yLimit;
+   int32_t stepsHigh = ystep > 0 ? yLimit - y0 : y0;
+   if (stepsHigh < 0 || stepsLow > (int32_t)dy || first > last) return;
+   if (stepsLow > 0)
    {
-      ystep = 1;
+      uint32_t k = ((stepsLow - 1) * dx + half + 1 + dy - 1) / dy;
+      if (k > first) first = k;
    }
-   else
+   if (stepsHigh < (int32_t)dy)
    {
-      ystep = -1;
+      uint32_t k = (stepsHigh * dx + half) / dy;
+      if (k < last) last = k;
    }
+   if (first > last) return;
+
+   uint32_t steps = ySteps(first);
+   int16_t x      = x0 + first;
+   int16_t xEnd   = x0 + last;
+   int16_t y      = y0 + ystep * (int16_t)steps;
+   int16_t yEnd   = y0 + ystep * (int16_t)ySteps(last);
+   // In [0, dx), the unsigned wrap cancels out
+   int32_t err = (int32_t)(half + steps * dx - first * dy);
+
+   int16_t yMin = y < yEnd ? y : yEnd;
+   int16_t yMax = y < yEnd ? yEnd : y;
+   if (steep)
+      markDirty(x >> 3, xEnd >> 3, yMin, yMax);
+   else
+      markDirty(yMin >> 3, yMax >> 3, x, xEnd);
 
-   for (; x0 <= x1; x0++)
+   // One run per y: a row of a shallow line, a column of a steep one,
+   // written a page byte at a time
+   int16_t runStart = x;
+   for (;; x++)
    {
+      err -= dy;
+      if (err >= 0 && x < xEnd) continue;
+
       if (steep)
-      {
-         setPixel(y0, x0);
-      }
+         writeColumn(screen, y, runStart, x - runStart + 1);
       else
-      {
-         setPixel(x0, y0);
-      }
-      err -= dy;
-      if (err < 0)
-      {
-         y0 += ystep;
-         err += dx;
-      }
+         writeRow(screen, runStart, y, x - runStart + 1);
+      if (x == xEnd) break;
+      y += ystep;
+      err += dx;
+      runStart = x + 1;
    }
 }
 
 void OLEDDisplay::drawRect(int16_t x, int16_t y, int16_t width, int16_t height)
 {
-   drawHorizontalLine(x, y, width);
-   drawVerticalLine(x, y, height);
-   drawVerticalLine(x + width - 1, y, height);
-   drawHorizontalLine(x, y + height - 1, width);
+   if (record(OLED_LIST_RECT, x, y, width, height)) return;
+   drawRect(runtimeScreen(), x, y, width, height);
 }
 
-void OLEDDisplay::fillRect(int16_t xMove, int16_t yMove, int16_t width, int16_t height)
+template <class Screen>
+void OLEDDisplay::drawRect(const Screen &screen, int16_t x, int16_t y, int16_t width, int16_t height)
 {
-   for (int16_t x = xMove; x < xMove + width; x++)
-   {
-      drawVerticalLine(x, yMove, height);
-   }
+   drawHorizontalLine(screen, x, y, width);
+   drawVerticalLine(screen, x, y, height);
+   drawVerticalLine(screen, x + width - 1, y, height);
+   drawHorizontalLine(screen, x, y + height - 1, width);
 }
 
-void OLEDDisplay::drawCircle(int16_t x0, int16_t y0, int16_t radius)
+void OLEDDisplay::fillRect(int16_t xMove, int16_t yMove, int16_t width, int16_t height)
 {
-   int16_t x = 0, y = radius;
-   int16_t dp = 1 - radius;
-   do
-   {
-      if (dp < 0)
-         dp = dp + 2 * (++x) + 3;
-      else
-         dp = dp + 2 * (++x) - 2 * (--y) + 5;
-
-      setPixel(x0 + x, y0 + y);  // For the 8 octants
-      setPixel(x0 - x, y0 + y);
-      setPixel(x0 + x, y0 - y);
-      setPixel(x0 - x, y0 - y);
-      setPixel(x0 + y, y0 + x);
-      setPixel(x0 - y, y0 + x);
-      setPixel(x0 + y, y0 - x);
-      setPixel(x0 - y, y0 - x);
-
-   } while (x < y);
-
-   setPixel(x0 + radius, y0);
-   setPixel(x0, y0 + radius);
-   setPixel(x0 - radius, y0);
-   setPixel(x0, y0 - radius);
+   if (record(OLED_LIST_FILL_RECT, xMove, yMove, width, height)) return;
+   fillRect(runtimeScreen(), xMove, yMove, width, height);
 }
 
-void OLEDDisplay::drawCircleQuads(int16_t x0, int16_t y0, int16_t radius, uint8_t quads)
+template <class Screen>
+void OLEDDisplay::fillRect(const Screen &screen, int16_t xMove, int16_t yMove, int16_t width, int16_t height)
 {
-   int16_t x = 0, y = radius;
-   int16_t dp = 1 - radius;
-   while (x < y)
+   // Clip once against the screen
+   if (xMove < 0)
    {
-      if (dp < 0)
-         dp = dp + 2 * (++x) + 3;
-      else
-         dp = dp + 2 * (++x) - 2 * (--y) + 5;
-      if (quads & 0x1)
+      width += xMove;
+      xMove = 0;
+   }
+   if (yMove < 0)
+   {
+      height += yMove;
+      yMove = 0;
+   }
+   if (xMove + width > screen.width)
+   {
+      width = screen.width - xMove;
+   }
+   if (yMove + height > screen.height)
+   {
+      height = screen.height - yMove;
+   }
+   if (width <= 0 || height <= 0) return;
+
+   uint8_t firstPage  = yMove >> 3;
+   uint8_t lastPage   = (yMove + height - 1) >> 3;
+   uint8_t topMask    = 0xFF << (yMove & 7);
+   uint8_t bottomMask = 0xFF >> (7 - ((yMove + height - 1) & 7));
+   markDirty(firstPage, lastPage, xMove, xMove + width - 1);
+
+   uint8_t *bufferPtr = buffer + firstPage * screen.width + xMove;
+
+   if (firstPage == lastPage)
+   {
+      fillPageRun(bufferPtr, width, topMask & bottomMask);
+      return;
+   }
+
+   fillPageRun(bufferPtr, width, topMask);
+   for (uint8_t page = firstPage + 1; page < lastPage; page++)
+   {
+      bufferPtr += screen.width;
+      fillPageRun(bufferPtr, width, 0xFF);
+   }
+   fillPageRun(bufferPtr + screen.width, width, bottomMask);
+}
+
+void OLEDDisplay::fillPageRun(uint8_t *bufferPtr, uint16_t length, uint8_t mask)
+{
+   // Every colour is ((byte & keep) | set) ^ flip, so the run needs no switch
+   uint8_t keep = (color == INVERSE) ? 0xFF : ~mask;
+   uint8_t set  = (color == WHITE) ? mask : 0x00;
+   uint8_t flip = (color == INVERSE) ? mask : 0x00;
+
+   // Single bytes until the pointer is word aligned
+   while (length && ((uintptr_t)bufferPtr & 3))
+   {
+      *bufferPtr = ((*bufferPtr & keep) | set) ^ flip;
+      bufferPtr++;
+      length--;
+   }
+
+   uint32_t keepWord = keep * 0x01010101UL;
+   uint32_t setWord  = set * 0x01010101UL;
+   uint32_t flipWord = flip * 0x01010101UL;
+
+   oled_word_t *wordPtr = (oled_word_t *)bufferPtr;
+   if (keepWord == 0)
+   {
+      // Solid WHITE/BLACK over a whole page, nothing to read back
+      for (; length >= 4; length -= 4)
       {
-         setPixel(x0 + x, y0 - y);
-         setPixel(x0 + y, y0 - x);
+         *wordPtr++ = setWord;
       }
-      if (quads & 0x2)
+   }
+   else
+   {
+      for (; length >= 4; length -= 4)
       {
-         setPixel(x0 - y, y0 - x);
-         setPixel(x0 - x, y0 - y);
+         *wordPtr = ((*wordPtr & keepWord) | setWord) ^ flipWord;
+         wordPtr++;
       }
-      if (quads & 0x4)
+   }
+
+   bufferPtr = (uint8_t *)wordPtr;
+   while (length--)
+   {
+      *bufferPtr = ((*bufferPtr & keep) | set) ^ flip;
+      bufferPtr++;
+   }
+}
+
+void OLEDDisplay::drawCircle(int16_t x0, int16_t y0, int16_t radius)
+{
+   if (record(OLED_LIST_CIRCLE, x0, y0, radius)) return;
+   drawCircle(runtimeScreen(), x0, y0, radius);
+}
+
+template <class Screen>
+void OLEDDisplay::drawCircle(const Screen &screen, int16_t x0, int16_t y0, int16_t radius)
+{
+   OLEDCircleSpans scratch;
+   const OLEDCircleSpans *spans = circleSpans(radius, scratch);
+   if (spans)
+   {
+      drawCircleSpans(screen, *spans, 0x0F, x0, y0, x0, y0);
+   }
+   else
+   {
+      int16_t x = 0, y = radius;
+      int16_t dp = 1 - radius;
+      do
       {
-         setPixel(x0 - y, y0 + x);
-         setPixel(x0 - x, y0 + y);
-      }
-      if (quads & 0x8)
+         if (dp < 0)
+            dp = dp + 2 * (++x) + 3;
+         else
+            dp = dp + 2 * (++x) - 2 * (--y) + 5;
+
+         setPixel(screen, x0 + x, y0 + y);  // For the 8 octants
+         setPixel(screen, x0 - x, y0 + y);
+         setPixel(screen, x0 + x, y0 - y);
+         setPixel(screen, x0 - x, y0 - y);
+         setPixel(screen, x0 + y, y0 + x);
+         setPixel(screen, x0 - y, y0 + x);
+         setPixel(screen, x0 + y, y0 - x);
+         setPixel(screen, x0 - y, y0 - x);
+
+      } while (x < y);
+   }
+
+   setPixel(screen, x0 + radius, y0);
+   setPixel(screen, x0, y0 + radius);
+   setPixel(screen, x0 - radius, y0);
+   setPixel(screen, x0, y0 - radius);
+}
+
+void OLEDDisplay::drawCircleQuads(int16_t x0, int16_t y0, int16_t radius, uint8_t quads)
+{
+   if (record(OLED_LIST_CIRCLE_QUADS, x0, y0, radius, quads)) return;
+   drawCircleQuads(runtimeScreen(), x0, y0, radius, quads);
+}
+
+template <class Screen>
+void OLEDDisplay::drawCircleQuads(const Screen &screen, int16_t x0, int16_t y0, int16_t radius, uint8_t quads)
+{
+   OLEDCircleSpans scratch;
+   const OLEDCircleSpans *spans = circleSpans(radius, scratch);
+   if (spans)
+   {
+      drawCircleSpans(screen, *spans, quads, x0, y0, x0, y0);
+   }
+   else
+   {
+      int16_t x = 0, y = radius;
+      int16_t dp = 1 - radius;
+      while (x < y)
       {
-         setPixel(x0 + x, y0 + y);
-         setPixel(x0 + y, y0 + x);
+         if (dp < 0)
+            dp = dp + 2 * (++x) + 3;
+         else
+            dp = dp + 2 * (++x) - 2 * (--y) + 5;
+         if (quads & 0x1)
+         {
+            setPixel(screen, x0 + x, y0 - y);
+            setPixel(screen, x0 + y, y0 - x);
+         }
+         if (quads & 0x2)
+         {
+            setPixel(screen, x0 - y, y0 - x);
+            setPixel(screen, x0 - x, y0 - y);
+         }
+         if (quads & 0x4)
+         {
+            setPixel(screen, x0 - y, y0 + x);
+            setPixel(screen, x0 - x, y0 + y);
+         }
+         if (quads & 0x8)
+         {
+            setPixel(screen, x0 + x, y0 + y);
+            setPixel(screen, x0 + y, y0 + x);
+         }
       }
    }
    if (quads & 0x1 && quads & 0x8)
    {
-      setPixel(x0 + radius, y0);
+      setPixel(screen, x0 + radius, y0);
    }
    if (quads & 0x4 && quads & 0x8)
    {
-      setPixel(x0, y0 + radius);
+      setPixel(screen, x0, y0 + radius);
    }
    if (quads & 0x2 && quads & 0x4)
    {
-      setPixel(x0 - radius, y0);
+      setPixel(screen, x0 - radius, y0);
    }
    if (quads & 0x1 && quads & 0x2)
    {
-      setPixel(x0, y0 - radius);
+      setPixel(screen, x0, y0 - radius);
    }
 }
 
 void OLEDDisplay::fillCircle(int16_t x0, int16_t y0, int16_t radius)
 {
+   if (record(OLED_LIST_FILL_CIRCLE, x0, y0, radius)) return;
+   fillCircle(runtimeScreen(), x0, y0, radius);
+}
+
+template <class Screen>
+void OLEDDisplay::fillCircle(const Screen &screen, int16_t x0, int16_t y0, int16_t radius)
+{
+   OLEDCircleSpans scratch;
+   const OLEDCircleSpans *spans = circleSpans(radius, scratch);
+   if (spans)
+   {
+      // The same pixels as the rows below, one column run each
+      if (!markDirtyBox(screen, x0 - radius, y0 - radius, x0 + radius - 1, y0 + radius)) return;
+      for (int16_t m = 1; m <= radius; m++)
+      {
+         int16_t height = spans->fillHeight[m];
+         fillColumn(screen, x0 - m, y0 - height, 2 * height + 1);
+         fillColumn(screen, x0 + m - 1, y0 - height, 2 * height + 1);
+      }
+      return;
+   }
+
    int16_t x = 0, y = radius;
    int16_t dp = 1 - radius;
    do
@@ -581,20 +1734,168 @@ void OLEDDisplay::fillCircle(int16_t x0, int16_t y0, int16_t radius)
       else
          dp = dp + 2 * (++x) - 2 * (--y) + 5;
 
-      drawHorizontalLine(x0 - x, y0 - y, 2 * x);
-      drawHorizontalLine(x0 - x, y0 + y, 2 * x);
-      drawHorizontalLine(x0 - y, y0 - x, 2 * y);
-      drawHorizontalLine(x0 - y, y0 + x, 2 * y);
+      drawHorizontalLine(screen, x0 - x, y0 - y, 2 * x);
+      drawHorizontalLine(screen, x0 - x, y0 + y, 2 * x);
+      drawHorizontalLine(screen, x0 - y, y0 - x, 2 * y);
+      drawHorizontalLine(screen, x0 - y, y0 + x, 2 * y);
 
    } while (x < y);
-   drawHorizontalLine(x0 - radius, y0, 2 * radius);
+   drawHorizontalLine(screen, x0 - radius, y0, 2 * radius);
 }
 
-void OLEDDisplay::drawHorizontalLine(int16_t x, int16_t y, int16_t length)
+const OLEDCircleSpans *OLEDDisplay::circleSpans(int16_t radius, OLEDCircleSpans &scratch)
+{
+   if (radius < 2 || radius > OLEDDISPLAY_CIRCLE_SPAN_RADIUS) return NULL;
+
+#ifndef OLEDDISPLAY_CIRCLE_SPAN_CACHE
+   scratch.build(radius);
+   return &scratch;
+#else
+   (void)scratch;
+   for (uint8_t i = 0; i < 2; i++)
+   {
+      if (circleSpanCache[i].radius == radius)
+      {
+         circleSpansNext = 1 - i;
+         return &circleSpanCache[i];
+      }
+   }
+
+   OLEDCircleSpans &spans = circleSpanCache[circleSpansNext];
+   circleSpansNext        = 1 - circleSpansNext;
+   spans.build(radius);
+   return &spans;
+#endif
+}
+
+template <class Screen>
+void OLEDDisplay::drawCircleSpans(const Screen &screen, const OLEDCircleSpans &spans, uint8_t quads,
+                                  int16_t left, int16_t top, int16_t right, int16_t bottom)
+{
+   int16_t radius = spans.radius;
+   if (!markDirtyBox(screen, left - radius, top - radius, right + radius, bottom + radius)) return;
+
+   // The outline is symmetric to the diagonal, row d holds the columns
+   // outlineLow[d] to outlineHigh[d]. Points below the diagonal go into the
+   // column runs, the others into the row runs, 1 to 2 pixels each near it
+   for (int16_t d = 1; d <= radius; d++)
+   {
+      int16_t low  = spans.outlineLow[d];
+      int16_t high = spans.outlineHigh[d];
+      if (low > d) continue;
+
+      int16_t length = (high < d ? high : d) - low + 1;
+      if (quads & 0x1) fillColumn(screen, right + d, top - low - length + 1, length);
+      if (quads & 0x2) fillColumn(screen, left - d, top - low - length + 1, length);
+      if (quads & 0x4) fillColumn(screen, left - d, bottom + low, length);
+      if (quads & 0x8) fillColumn(screen, right + d, bottom + low, length);
+
+      length = (high < d - 1 ? high : d - 1) - low + 1;
+      if (length <= 0) continue;
+      if (quads & 0x1) fillRow(screen, right + low, top - d, length);
+      if (quads & 0x2) fillRow(screen, left - low - length + 1, top - d, length);
+      if (quads & 0x4) fillRow(screen, left - low - length + 1, bottom + d, length);
+      if (quads & 0x8) fillRow(screen, right + low, bottom + d, length);
+   }
+}
+
+int16_t OLEDDisplay::cornerRadius(int16_t width, int16_t height, int16_t radius)
+{
+   int16_t limit = (width < height ? width : height) / 2;
+   if (radius > limit) radius = limit;
+   if (radius > OLEDDISPLAY_CIRCLE_SPAN_RADIUS) radius = OLEDDISPLAY_CIRCLE_SPAN_RADIUS;
+   return radius < 0 ? 0 : radius;
+}
+
+void OLEDDisplay::drawRoundRect(int16_t x, int16_t y, int16_t width, int16_t height, int16_t radius)
+{
+   if (record(OLED_LIST_ROUND_RECT, x, y, width, height, radius)) return;
+   drawRoundRect(runtimeScreen(), x, y, width, height, radius);
+}
+
+template <class Screen>
+void OLEDDisplay::drawRoundRect(const Screen &screen, int16_t x, int16_t y, int16_t width, int16_t height,
+                                int16_t radius)
 {
-   if (y < 0 || y >= _display_height)
+   radius = cornerRadius(width, height, radius);
+   if (!radius)
    {
+      drawRect(screen, x, y, width, height);
+      return;
+   }
+
+   // The centres of the corners. The straight edges run between them, the
+   // quadrants lie outside, so no pixel is drawn twice. Radius 1 leaves the
+   // corner pixels out
+   int16_t left = x + radius, right = x + width - 1 - radius;
+   int16_t top = y + radius, bottom = y + height - 1 - radius;
+   drawHorizontalLine(screen, left, y, right - left + 1);
+   drawHorizontalLine(screen, left, y + height - 1, right - left + 1);
+   drawVerticalLine(screen, x, top, bottom - top + 1);
+   drawVerticalLine(screen, x + width - 1, top, bottom - top + 1);
+
+   OLEDCircleSpans scratch;
+   const OLEDCircleSpans *spans = circleSpans(radius, scratch);
+   if (spans) drawCircleSpans(screen, *spans, 0x0F, left, top, right, bottom);
+}
+
+void OLEDDisplay::fillRoundRect(int16_t x, int16_t y, int16_t width, int16_t height, int16_t radius)
+{
+   if (record(OLED_LIST_FILL_ROUND_RECT, x, y, width, height, radius)) return;
+   fillRoundRect(runtimeScreen(), x, y, width, height, radius);
+}
+
+template <class Screen>
+void OLEDDisplay::fillRoundRect(const Screen &screen, int16_t x, int16_t y, int16_t width, int16_t height,
+                                int16_t radius)
+{
+   radius = cornerRadius(width, height, radius);
+   int16_t left = x + radius, right = x + width - 1 - radius;
+   int16_t top = y + radius, bottom = y + height - 1 - radius;
+   fillRect(screen, left, y, right - left + 1, height);
+
+   // The columns of the corners reach from the outline at the top to the
+   // one at the bottom, the pixels drawRoundRect() draws included
+   if (!markDirtyBox(screen, x, y, left - 1, y + height - 1) &
+       !markDirtyBox(screen, right + 1, y, x + width - 1, y + height - 1))
       return;
+   OLEDCircleSpans scratch;
+   const OLEDCircleSpans *spans = circleSpans(radius, scratch);
+   for (int16_t c = 1; c <= radius; c++)
+   {
+      int16_t high   = spans ? spans->outlineHigh[c] : 0;
+      int16_t length = bottom - top + 2 * high + 1;
+      fillColumn(screen, left - c, top - high, length);
+      fillColumn(screen, right + c, top - high, length);
+   }
+}
+
+void OLEDDisplay::drawHorizontalLine(int16_t x, int16_t y, int16_t length)
+{
+   if (record(OLED_LIST_HLINE, x, y, length)) return;
+   drawHorizontalLine(runtimeScreen(), x, y, length);
+}
+
+template <class Screen>
+void OLEDDisplay::drawHorizontalLine(const Screen &screen, int16_t x, int16_t y, int16_t length)
+{
+   if (!clipRow(screen, x, y, length)) return;
+   markDirty(y >> 3, y >> 3, x, x + length - 1);
+   writeRow(screen, x, y, length);
+}
+
+template <class Screen>
+inline void OLEDDisplay::fillRow(const Screen &screen, int16_t x, int16_t y, int16_t length)
+{
+   if (clipRow(screen, x, y, length)) writeRow(screen, x, y, length);
+}
+
+template <class Screen>
+inline bool OLEDDisplay::clipRow(const Screen &screen, int16_t &x, int16_t y, int16_t &length)
+{
+   if (y < 0 || y >= screen.height)
+   {
+      return false;
    }
 
    if (x < 0)
@@ -603,18 +1904,19 @@ void OLEDDisplay::drawHorizontalLine(int16_t x, int16_t y, int16_t length)
       x = 0;
    }
 
-   if ((x + length) > _display_width)
+   if ((x + length) > screen.width)
    {
-      length = (_display_width - x);
+      length = (screen.width - x);
    }
 
-   if (length <= 0)
-   {
-      return;
-   }
+   return length > 0;
+}
 
+template <class Screen>
+inline void OLEDDisplay::writeRow(const Screen &screen, int16_t x, int16_t y, int16_t length)
+{
    uint8_t *bufferPtr = buffer;
-   bufferPtr += (y >> 3) * _display_width;
+   bufferPtr += (y >> 3) * screen.width;
    bufferPtr += x;
 
    uint8_t drawBit = 1 << (y & 7);
@@ -645,7 +1947,28 @@ void OLEDDisplay::drawHorizontalLine(int16_t x, int16_t y, int16_t length)
 
 void OLEDDisplay::drawVerticalLine(int16_t x, int16_t y, int16_t length)
 {
-   if (x < 0 || x >= _display_width) return;
+   if (record(OLED_LIST_VLINE, x, y, length)) return;
+   drawVerticalLine(runtimeScreen(), x, y, length);
+}
+
+template <class Screen>
+void OLEDDisplay::drawVerticalLine(const Screen &screen, int16_t x, int16_t y, int16_t length)
+{
+   if (!clipColumn(screen, x, y, length)) return;
+   markDirty(y >> 3, (y + length - 1) >> 3, x, x);
+   writeColumn(screen, x, y, length);
+}
+
+template <class Screen>
+inline void OLEDDisplay::fillColumn(const Screen &screen, int16_t x, int16_t y, int16_t length)
+{
+   if (clipColumn(screen, x, y, length)) writeColumn(screen, x, y, length);
+}
+
+template <class Screen>
+inline bool OLEDDisplay::clipColumn(const Screen &screen, int16_t x, int16_t &y, int16_t &length)
+{
+   if (x < 0 || x >= screen.width) return false;
 
    if (y < 0)
    {
@@ -653,18 +1976,34 @@ void OLEDDisplay::drawVerticalLine(int16_t x, int16_t y, int16_t length)
       y = 0;
    }
 
-   if ((y + length) > _display_height)
+   if ((y + length) > screen.height)
    {
-      length = (_display_height - y);
+      length = (screen.height - y);
    }
 
-   if (length <= 0) return;
+   return length > 0;
+}
+
+template <class Screen>
+bool OLEDDisplay::markDirtyBox(const Screen &screen, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+   if (x0 < 0) x0 = 0;
+   if (y0 < 0) y0 = 0;
+   if (x1 >= screen.width) x1 = screen.width - 1;
+   if (y1 >= screen.height) y1 = screen.height - 1;
+   if (x0 > x1 || y0 > y1) return false;
+   markDirty(y0 >> 3, y1 >> 3, x0, x1);
+   return true;
+}
 
+template <class Screen>
+inline void OLEDDisplay::writeColumn(const Screen &screen, int16_t x, int16_t y, int16_t length)
+{
    uint8_t yOffset = y & 7;
    uint8_t drawBit;
    uint8_t *bufferPtr = buffer;
 
-   bufferPtr += (y >> 3) * _display_width;
+   bufferPtr += (y >> 3) * screen.width;
    bufferPtr += x;
 
    if (yOffset)
@@ -693,7 +2032,7 @@ void OLEDDisplay::drawVerticalLine(int16_t x, int16_t y, int16_t length)
       if (length < yOffset) return;
 
       length -= yOffset;
-      bufferPtr += _display_width;
+      bufferPtr += screen.width;
    }
 
    if (length >= 8)
@@ -706,7 +2045,7 @@ void OLEDDisplay::drawVerticalLine(int16_t x, int16_t y, int16_t length)
             do
             {
                *bufferPtr = drawBit;
-               bufferPtr += _display_width;
+               bufferPtr += screen.width;
                length -= 8;
             } while (length >= 8);
             break;
@@ -714,7 +2053,7 @@ void OLEDDisplay::drawVerticalLine(int16_t x, int16_t y, int16_t length)
             do
             {
                *bufferPtr = ~(*bufferPtr);
-               bufferPtr += _display_width;
+               bufferPtr += screen.width;
                length -= 8;
             } while (length >= 8);
             break;
@@ -742,35 +2081,38 @@ void OLEDDisplay::drawVerticalLine(int16_t x, int16_t y, int16_t length)
 void OLEDDisplay::drawProgressBar(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
                                   uint8_t progress)
 {
-   uint16_t radius       = height / 2;
-   uint16_t xRadius      = x + radius;
-   uint16_t yRadius      = y + radius;
-   uint16_t doubleRadius = 2 * radius;
-   uint16_t innerRadius  = radius - 2;
+   int16_t radius = height / 2;
 
    setColor(WHITE);
-   drawCircleQuads(xRadius, yRadius, radius, 0b00000110);
-   drawHorizontalLine(xRadius, y, width - doubleRadius + 1);
-   drawHorizontalLine(xRadius, y + height, width - doubleRadius + 1);
-   drawCircleQuads(x + width - radius, yRadius, radius, 0b00001001);
-
-   uint16_t maxProgressWidth = (width - doubleRadius - 1) * progress / 100;
-
-   fillCircle(xRadius, yRadius, innerRadius);
-   fillRect(xRadius + 1, y + 2, maxProgressWidth, height - 3);
-   fillCircle(xRadius + maxProgressWidth, yRadius, innerRadius);
+   drawRoundRect(x, y, width + 1, height + 1, radius);
+
+   // The bar keeps a column and a row of space to the border and grows from
+   // a circle to the full inner width
+   int16_t innerWidth  = width - 3;
+   int16_t innerHeight = height - 3;
+   if (innerWidth <= 0 || innerHeight <= 0) return;
+   int16_t minWidth = innerHeight < innerWidth ? innerHeight : innerWidth;
+   if (progress > 100) progress = 100;
+   int16_t barWidth = minWidth + (int32_t)(innerWidth - minWidth) * progress / 100;
+   fillRoundRect(x + 2, y + 2, barWidth, innerHeight, radius - 2);
 }
 
 void OLEDDisplay::drawFastImage(int16_t xMove, int16_t yMove, int16_t width, int16_t height,
                                 const char *image)
 {
+   if (recordData(OLED_LIST_IMAGE, &image, sizeof(image), xMove, yMove, width, height)) return;
    drawInternal(xMove, yMove, width, height, image, 0, 0);
 }
 
 void OLEDDisplay::drawXbm(int16_t xMove, int16_t yMove, int16_t width, int16_t height,
                           const char *xbm)
 {
+   if (recordData(OLED_LIST_XBM, &xbm, sizeof(xbm), xMove, yMove, width, height)) return;
+
    int16_t widthInXbm = (width + 7) / 8;
+
+#ifdef __AVR__
+   // pgm_read_byte can't read the transposed blocks from RAM, draw pixel by pixel
    uint8_t data;
 
    for (int16_t y = 0; y < height; y++)
@@ -792,17 +2134,223 @@ void OLEDDisplay::drawXbm(int16_t xMove, int16_t yMove, int16_t width, int16_t h
          }
       }
    }
+#else
+   if (width <= 0 || height <= 0) return;
+   if (xMove + width <= 0 || xMove >= _display_width) return;
+   if (yMove + height <= 0 || yMove >= _display_height) return;
+
+   // Only transpose the 8x8 blocks that can reach the screen
+   int16_t firstBlock = (xMove < 0) ? (-xMove) >> 3 : 0;
+   int16_t endBlock   = min(widthInXbm, (int16_t)((_display_width - xMove + 7) >> 3));
+   int16_t firstStrip = (yMove < 0) ? (-yMove) >> 3 : 0;
+   int16_t endStrip   = min((int16_t)((height + 7) >> 3), (int16_t)((_display_height - yMove + 7) >> 3));
+
+   uint8_t rows[8];
+   uint8_t columns[OLEDDISPLAY_XBM_CHUNK_BLOCKS * 8];
+
+   for (int16_t strip = firstStrip; strip < endStrip; strip++)
+   {
+      int16_t y            = strip << 3;
+      uint8_t rowsInStrip  = min((int16_t)8, (int16_t)(height - y));
+      const char *stripPtr = xbm + y * widthInXbm;
+
+      int16_t chunkBlock = firstBlock;
+      uint8_t filled     = 0;
+      for (int16_t block = firstBlock; block < endBlock; block++)
+      {
+         for (uint8_t r = 0; r < 8; r++)
+         {
+            rows[r] = (r < rowsInStrip) ? pgm_read_byte(stripPtr + block + r * widthInXbm) : 0;
+         }
+         oledTranspose8x8(rows, &columns[filled]);
+         filled += 8;
+
+         if (filled == sizeof(columns) || block == endBlock - 1)
+         {
+            // The last block may hold padding bits past the image width
+            int16_t x     = chunkBlock << 3;
+            int16_t count = min((int16_t)filled, (int16_t)(width - x));
+            drawInternal(xMove + x, yMove + y, count, 8, (const char *)columns, 0, count);
+            chunkBlock = block + 1;
+            filled     = 0;
+         }
+      }
+   }
+#endif
+}
+
+void OLEDDisplay::loadFontMetrics()
+{
+   if (fontMetrics.font == fontData && fontMetrics.scale == fontScale) return;
+
+   uint8_t firstChar = pgm_read_byte(fontData + FIRST_CHAR_POS);
+   uint8_t charNum   = pgm_read_byte(fontData + CHAR_NUM_POS);
+
+   // Codes past 255 don't exist, the index of getCharWidth() would wrap
+   if (firstChar + charNum > 256) charNum = 256 - firstChar;
+
+   fontMetrics.firstChar  = firstChar;
+   fontMetrics.charNum    = charNum;
+   fontMetrics.count      = min(charNum, (uint8_t)OLEDDISPLAY_FONT_METRICS_CHARS);
+   fontMetrics.maxAdvance = 0;
+   for (uint8_t i = 0; i < charNum; i++)
+   {
+      uint8_t width = pgm_read_byte(fontData + JUMPTABLE_START + i * JUMPTABLE_BYTES + JUMPTABLE_WIDTH) * fontScale;
+      if (i < fontMetrics.count) fontMetrics.advance[i] = width;
+      fontMetrics.maxAdvance = max(fontMetrics.maxAdvance, width);
+   }
+   fontMetrics.font  = fontData;
+   fontMetrics.scale = fontScale;
 }
 
-void OLEDDisplay::drawStringInternal(int16_t xMove, int16_t yMove, char *text, uint16_t textLength,
-                                     uint16_t textWidth)
+#ifdef OLEDDISPLAY_GLYPH_CACHE
+const OLEDGlyph *OLEDDisplay::cacheGlyph(uint8_t code, uint8_t shift)
 {
-   uint8_t textHeight       = pgm_read_byte(fontData + HEIGHT_POS);
+   // Bit 11 tells a used slot from the cleared key 0
+   uint32_t key = ((uint32_t)(uintptr_t)fontData << 16) | 0x800 | (shift << 8) | code;
+   for (uint8_t i = 0; i < OLEDDISPLAY_GLYPH_CACHE; i++)
+   {
+      if (glyphCacheKeys[i] == key && glyphCache[i].font == fontData)
+      {
+         glyphCacheHits++;
+         glyphCacheLastUse[i] = ++glyphCacheClock;
+         return &glyphCache[i];
+      }
+   }
+   glyphCacheMisses++;
+
+   uint8_t slot = 0;
+   for (uint8_t i = 1; i < OLEDDISPLAY_GLYPH_CACHE; i++)
+   {
+      if (glyphCacheLastUse[i] < glyphCacheLastUse[slot]) slot = i;
+   }
+
+   // drawStringInternal() made sure the font has the code
+   uint8_t height           = pgm_read_byte(fontData + HEIGHT_POS);
    uint8_t firstChar        = pgm_read_byte(fontData + FIRST_CHAR_POS);
    uint16_t sizeOfJumpTable = pgm_read_byte(fontData + CHAR_NUM_POS) * JUMPTABLE_BYTES;
+   const char *jump         = fontData + JUMPTABLE_START + (code - firstChar) * JUMPTABLE_BYTES;
+   uint8_t msbJumpToChar    = pgm_read_byte(jump);
+   uint8_t lsbJumpToChar    = pgm_read_byte(jump + JUMPTABLE_LSB);
+   uint8_t width            = pgm_read_byte(jump + JUMPTABLE_WIDTH);
+
+   bool rle             = pgm_read_byte(fontData + WIDTH_POS) & FONT_RLE;
+   uint8_t rasterHeight = 1 + ((height - 1) >> 3);
+   uint16_t bytes       = pgm_read_byte(jump + JUMPTABLE_SIZE);
+   if (bytes == 0) bytes = width * rasterHeight;
+   // An encoded glyph has at most `width` columns, how many shows when decoding
+   uint8_t columns = (msbJumpToChar == 255 && lsbJumpToChar == 255)
+                         ? 0
+                         : rle ? width : (bytes + rasterHeight - 1) / rasterHeight;
+   uint8_t bands = rasterHeight + (shift != 0);
+   if (rasterHeight > 8 || columns * bands > OLEDDISPLAY_GLYPH_CACHE_BYTES) return NULL;
+
+   glyphCacheKeys[slot]    = key;
+   glyphCacheLastUse[slot] = ++glyphCacheClock;
+   OLEDGlyph &glyph        = glyphCache[slot];
+   glyph.font              = fontData;
+   glyph.advance           = width;
+   glyph.height            = height;
+   glyph.columns           = columns;
+   glyph.bands             = bands;
+
+   // Row r of the font data lands on band r shifted up, the bits that fall
+   // out of it on band r + 1
+   const char *source =
+       fontData + JUMPTABLE_START + sizeOfJumpTable + ((msbJumpToChar << 8) + lsbJumpToChar);
+   uint8_t *target = glyph.data;
+   uint8_t rows[8];
+   OLEDRleGlyph decoder(source, bytes, height);
+   uint8_t column = 0;
+   for (; column < columns; column++)
+   {
+      if (rle)
+      {
+         if (!decoder.column(rows)) break;
+      }
+      else
+      {
+         for (uint8_t row = 0; row < rasterHeight; row++)
+         {
+            uint16_t i = column * rasterHeight + row;
+            rows[row]  = i < bytes ? pgm_read_byte(source + i) : 0;
+         }
+      }
+
+      uint8_t spill = 0;
+      for (uint8_t band = 0; band < bands; band++)
+      {
+         uint8_t bits = band < rasterHeight ? rows[band] : 0;
+         *target++    = (uint8_t)(bits << shift) | spill;
+         spill        = shift ? bits >> (8 - shift) : 0;
+      }
+   }
+   glyph.columns = column;
+   return &glyph;
+}
+
+void OLEDDisplay::drawGlyph(int16_t xMove, int16_t yMove, const OLEDGlyph &glyph)
+{
+   if (yMove + glyph.height <= 0 || yMove >= _display_height) return;
+   if (xMove + glyph.advance <= 0 || xMove >= _display_width) return;
+
+   int16_t firstColumn = (xMove < 0) ? -xMove : 0;
+   int16_t endColumn   = min((int16_t)glyph.columns, (int16_t)(_display_width - xMove));
+   if (firstColumn >= endColumn) return;
+
+   int16_t page      = yMove >> 3;
+   int16_t pages     = _display_height >> 3;
+   int16_t firstBand = (page < 0) ? -page : 0;
+   int16_t endBand   = min((int16_t)glyph.bands, (int16_t)(pages - page));
+
+   markDirty(page + firstBand, page + endBand - 1, xMove + firstColumn, xMove + endColumn - 1);
+
+   uint8_t *target       = buffer + (page + firstBand) * _display_width + xMove + firstColumn;
+   const uint8_t *source = glyph.data + firstColumn * glyph.bands;
+   int16_t columns       = endColumn - firstColumn;
+   switch (color)
+   {
+      case WHITE:
+         oledBlitGlyph<WHITE>(target, _display_width, source, glyph.bands, columns, firstBand, endBand);
+         break;
+      case BLACK:
+         oledBlitGlyph<BLACK>(target, _display_width, source, glyph.bands, columns, firstBand, endBand);
+         break;
+      case INVERSE:
+         oledBlitGlyph<INVERSE>(target, _display_width, source, glyph.bands, columns, firstBand, endBand);
+         break;
+   }
+}
+
+void OLEDDisplay::resetGlyphCacheStats()
+{
+   glyphCacheHits   = 0;
+   glyphCacheMisses = 0;
+}
+
+void OLEDDisplay::clearGlyphCache()
+{
+   for (uint8_t i = 0; i < OLEDDISPLAY_GLYPH_CACHE; i++)
+   {
+      glyphCacheKeys[i]    = 0;
+      glyphCacheLastUse[i] = 0;
+   }
+   glyphCacheClock = 0;
+}
+#endif
+
+void OLEDDisplay::drawStringInternal(int16_t xMove, int16_t yMove, const char *text,
+                                     uint16_t textLength, uint16_t textWidth, bool utf8)
+{
+   uint8_t glyphHeight      = pgm_read_byte(fontData + HEIGHT_POS);
+   uint16_t textHeight      = glyphHeight * fontScale;
+   uint8_t firstChar        = pgm_read_byte(fontData + FIRST_CHAR_POS);
+   uint8_t charNum          = pgm_read_byte(fontData + CHAR_NUM_POS);
+   uint16_t sizeOfJumpTable = charNum * JUMPTABLE_BYTES;
+   bool rle                 = pgm_read_byte(fontData + WIDTH_POS) & FONT_RLE;
 
-   uint8_t cursorX = 0;
-   uint8_t cursorY = 0;
+   int16_t cursorX = 0;
+   int16_t cursorY = 0;
 
    switch (textAlignment)
    {
@@ -817,8 +2365,9 @@ void OLEDDisplay::drawStringInternal(int16_t xMove, int16_t yMove, char *text, u
          break;
    }
 
-   // Don't draw anything if it is not on the screen.
-   if (xMove + textWidth < 0 || xMove > _display_width)
+   // Don't draw anything if it is not on the screen. Left aligned text is
+   // not measured (textWidth 0), its glyphs are clipped one by one
+   if ((textAlignment != TEXT_ALIGN_LEFT && xMove + textWidth < 0) || xMove > _display_width)
    {
       return;
    }
@@ -826,15 +2375,34 @@ void OLEDDisplay::drawStringInternal(int16_t xMove, int16_t yMove, char *text, u
    {
       return;
    }
+   // Recorded aligned, the replay draws it left aligned
+   if (recordData(utf8 ? OLED_LIST_TEXT : OLED_LIST_CODES, text, textLength, xMove, yMove, textLength))
+   {
+      return;
+   }
 
+   OLEDUtf8Decoder decoder;
    for (uint16_t j = 0; j < textLength; j++)
    {
       int16_t xPos = xMove + cursorX;
       int16_t yPos = yMove + cursorY;
 
+      // Everything from here on is right of the screen
+      if (xPos >= _display_width) break;
+
       byte code = text[j];
-      if (code >= firstChar)
+      if (utf8) code = decoder.next(code);
+      if (code >= firstChar && code - firstChar < charNum)
       {
+#ifdef OLEDDISPLAY_GLYPH_CACHE
+         const OLEDGlyph *glyph = fontScale == 1 ? cacheGlyph(code, yPos & 7) : NULL;
+         if (glyph)
+         {
+            drawGlyph(xPos, yPos, *glyph);
+            cursorX += glyph->advance;
+            continue;
+         }
+#endif
          byte charCode = code - firstChar;
 
          // 4 Bytes per char code
@@ -853,21 +2421,26 @@ void OLEDDisplay::drawStringInternal(int16_t xMove, int16_t yMove, char *text, u
             // Get the position of the char data
             uint16_t charDataPosition =
                 JUMPTABLE_START + sizeOfJumpTable + ((msbJumpToChar << 8) + lsbJumpToChar);
-            drawInternal(xPos, yPos, currentCharWidth, textHeight, fontData, charDataPosition,
-                         charByteSize);
+            if (fontScale > 1)
+               drawScaledGlyph(xPos, yPos, currentCharWidth, glyphHeight, fontData + charDataPosition,
+                               charByteSize, rle);
+            else if (rle)
+               drawRleGlyph(xPos, yPos, currentCharWidth, textHeight, fontData + charDataPosition,
+                            charByteSize);
+            else
+               drawInternal(xPos, yPos, currentCharWidth, textHeight, fontData, charDataPosition,
+                            charByteSize);
          }
 
-         cursorX += currentCharWidth;
+         cursorX += currentCharWidth * fontScale;
       }
    }
 }
 
-void OLEDDisplay::drawString(int16_t xMove, int16_t yMove, String strUser)
+void OLEDDisplay::drawString(int16_t xMove, int16_t yMove, const char *text, uint16_t length)
 {
-   uint16_t lineHeight = pgm_read_byte(fontData + HEIGHT_POS);
-
-   // char* text must be freed!
-   char *text = utf8ascii(strUser);
+   uint16_t lineHeight = getFontHeight();
+   const char *end     = text + length;
 
    uint16_t yOffset = 0;
    // If the string should be centered vertically too
@@ -876,111 +2449,206 @@ void OLEDDisplay::drawString(int16_t xMove, int16_t yMove, String strUser)
    {
       uint16_t lb = 0;
       // Find number of linebreaks in text
-      for (uint16_t i = 0; text[i] != 0; i++)
+      for (const char *c = text; c < end; c++)
       {
-         lb += (text[i] == 10);
+         lb += (*c == 10);
       }
       // Calculate center
       yOffset = (lb * lineHeight) / 2;
    }
 
-   uint16_t line  = 0;
-   char *textPart = strtok(text, "\n");
-   while (textPart != NULL)
+   // The text is split at '\n' in place, empty lines are skipped like
+   // strtok() used to do. Left aligned lines don't need their width
+   uint16_t line = 0;
+   while (text < end)
    {
-      uint16_t length = strlen(textPart);
-      drawStringInternal(xMove, yMove - yOffset + (line++) * lineHeight, textPart, length,
-                         getStringWidth(textPart, length));
-      textPart = strtok(NULL, "\n");
+      const char *lineEnd = (const char *)memchr(text, 10, end - text);
+      if (!lineEnd) lineEnd = end;
+
+      uint16_t lineLength = lineEnd - text;
+      if (lineLength > 0)
+      {
+         uint16_t width = textAlignment == TEXT_ALIGN_LEFT ? 0 : getStringWidth(text, lineLength);
+         drawStringInternal(xMove, yMove - yOffset + (line++) * lineHeight, text, lineLength, width,
+                            true);
+      }
+      text = lineEnd + 1;
    }
-   free(text);
 }
 
-void OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t maxLineWidth,
-                                     String strUser)
+void OLEDDisplay::drawString(int16_t xMove, int16_t yMove, const char *text)
 {
-   uint16_t firstChar  = pgm_read_byte(fontData + FIRST_CHAR_POS);
-   uint16_t lineHeight = pgm_read_byte(fontData + HEIGHT_POS);
-
-   char *text = utf8ascii(strUser);
-
-   uint16_t length       = strlen(text);
-   uint16_t lastDrawnPos = 0;
-   uint16_t lineNumber   = 0;
-   uint16_t strWidth     = 0;
+   drawString(xMove, yMove, text, strlen(text));
+}
 
-   uint16_t preferredBreakpoint = 0;
-   uint16_t widthAtBreakpoint   = 0;
+void OLEDDisplay::drawString(int16_t xMove, int16_t yMove, const String &text)
+{
+   drawString(xMove, yMove, text.c_str(), text.length());
+}
 
+template <typename Emit>
+void OLEDDisplay::wrapText(const char *text, uint16_t length, uint16_t maxLineWidth, Emit emit)
+{
+   loadFontMetrics();
+
+   OLEDTextLine line    = {0, 0, 0};
+   uint16_t lineWidth   = 0;  // of text[line.offset, charStart)
+   uint16_t charStart   = 0;  // first byte of the current character
+   bool canBreak        = false;
+   uint16_t breakEnd    = 0;  // the line ends here when broken
+   uint16_t breakWidth  = 0;
+   uint16_t breakNext   = 0;  // and the next one starts here
+   uint16_t breakSkip   = 0;  // width of text[line.offset, breakNext)
+
+   OLEDUtf8Decoder decoder;
    for (uint16_t i = 0; i < length; i++)
    {
-      strWidth += pgm_read_byte(fontData + JUMPTABLE_START +
-                                (text[i] - firstChar) * JUMPTABLE_BYTES + JUMPTABLE_WIDTH);
+      uint8_t code = decoder.next(text[i]);
+      if (!code) continue;
 
-      // Always try to break on a space or dash
-      if (text[i] == ' ' || text[i] == '-')
+      if (code == 10)
       {
-         preferredBreakpoint = i;
-         widthAtBreakpoint   = strWidth;
+         line.length = charStart - line.offset;
+         line.width  = lineWidth;
+         emit(line);
+         line.offset = charStart = i + 1;
+         lineWidth   = 0;
+         canBreak    = false;
+         continue;
       }
 
-      if (strWidth >= maxLineWidth)
+      uint8_t advance = getCharWidth(code);
+      if (code == ' ')
+      {
+         // Spaces may hang over the end of a line, it is broken before them
+         canBreak   = charStart > line.offset;
+         breakEnd   = charStart;
+         breakWidth = lineWidth;
+         breakNext  = i + 1;
+         breakSkip  = lineWidth + advance;
+      }
+      else
       {
-         if (preferredBreakpoint == 0)
+         if (lineWidth + advance > maxLineWidth && canBreak)
+         {
+            line.length = breakEnd - line.offset;
+            line.width  = breakWidth;
+            emit(line);
+            line.offset = breakNext;
+            lineWidth -= breakSkip;
+            canBreak = false;
+         }
+         if (lineWidth + advance > maxLineWidth && charStart > line.offset)
          {
-            preferredBreakpoint = i;
-            widthAtBreakpoint   = strWidth;
+            line.length = charStart - line.offset;
+            line.width  = lineWidth;
+            emit(line);
+            line.offset = charStart;
+            lineWidth   = 0;
          }
-         drawStringInternal(xMove, yMove + (lineNumber++) * lineHeight, &text[lastDrawnPos],
-                            preferredBreakpoint - lastDrawnPos, widthAtBreakpoint);
-         lastDrawnPos = preferredBreakpoint + 1;
-         // It is possible that we did not draw all letters to i so we need
-         // to account for the width of the chars from `i - preferredBreakpoint`
-         // by calculating the width we did not draw yet.
-         strWidth            = strWidth - widthAtBreakpoint;
-         preferredBreakpoint = 0;
+      }
+      lineWidth += advance;
+      charStart = i + 1;
+
+      if (code == '-')
+      {
+         canBreak   = true;
+         breakEnd   = breakNext = charStart;
+         breakWidth = breakSkip = lineWidth;
       }
    }
 
-   // Draw last part if needed
-   if (lastDrawnPos < length)
+   if (line.offset < length)
    {
-      drawStringInternal(xMove, yMove + lineNumber * lineHeight, &text[lastDrawnPos],
-                         length - lastDrawnPos,
-                         getStringWidth(&text[lastDrawnPos], length - lastDrawnPos));
+      line.length = length - line.offset;
+      line.width  = lineWidth;
+      emit(line);
    }
-
-   free(text);
 }
 
-uint16_t OLEDDisplay::getStringWidth(const char *text, uint16_t length)
+uint16_t OLEDDisplay::layoutText(const char *text, uint16_t length, uint16_t maxLineWidth,
+                                 OLEDTextLine *lines, uint16_t maxLines)
 {
-   uint16_t firstChar = pgm_read_byte(fontData + FIRST_CHAR_POS);
+   uint16_t count = 0;
+   wrapText(text, length, maxLineWidth, [&](const OLEDTextLine &line) {
+      if (count < maxLines) lines[count] = line;
+      count++;
+   });
+   return count;
+}
+
+void OLEDDisplay::drawTextLayout(int16_t xMove, int16_t yMove, const char *text,
+                                 const OLEDTextLine *lines, uint16_t lineCount)
+{
+   uint16_t lineHeight = getFontHeight();
+   for (uint16_t i = 0; i < lineCount; i++)
+   {
+      drawStringInternal(xMove, yMove + i * lineHeight, text + lines[i].offset, lines[i].length,
+                         lines[i].width, true);
+   }
+}
+
+void OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t maxLineWidth,
+                                     const char *text, uint16_t length)
+{
+   uint16_t lineHeight = getFontHeight();
+   wrapText(text, length, maxLineWidth, [&](const OLEDTextLine &line) {
+      drawStringInternal(xMove, yMove, text + line.offset, line.length, line.width, true);
+      yMove += lineHeight;
+   });
+}
+
+void OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t maxLineWidth,
+                                     const char *text)
+{
+   drawStringMaxWidth(xMove, yMove, maxLineWidth, text, strlen(text));
+}
+
+void OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t maxLineWidth,
+                                     const String &text)
+{
+   drawStringMaxWidth(xMove, yMove, maxLineWidth, text.c_str(), text.length());
+}
+
+uint16_t OLEDDisplay::getStringWidth(const char *text, uint16_t length)
+{
+   loadFontMetrics();
 
    uint16_t stringWidth = 0;
    uint16_t maxWidth    = 0;
 
+   OLEDUtf8Decoder decoder;
    while (length--)
    {
-      stringWidth += pgm_read_byte(fontData + JUMPTABLE_START +
-                                   (text[length] - firstChar) * JUMPTABLE_BYTES + JUMPTABLE_WIDTH);
-      if (text[length] == 10)
+      uint8_t code = decoder.next(*text++);
+      if (code == 10)
       {
          maxWidth    = max(maxWidth, stringWidth);
          stringWidth = 0;
       }
+      else
+      {
+         stringWidth += getCharWidth(code);
+      }
    }
 
    return max(maxWidth, stringWidth);
 }
 
-uint16_t OLEDDisplay::getStringWidth(String strUser)
+uint16_t OLEDDisplay::getStringWidth(const char *text)
 {
-   char *text      = utf8ascii(strUser);
-   uint16_t length = strlen(text);
-   uint16_t width  = getStringWidth(text, length);
-   free(text);
-   return width;
+   return getStringWidth(text, strlen(text));
+}
+
+uint16_t OLEDDisplay::getStringWidth(const String &text)
+{
+   return getStringWidth(text.c_str(), text.length());
+}
+
+uint8_t OLEDDisplay::getMaxCharWidth()
+{
+   loadFontMetrics();
+   return fontMetrics.maxAdvance;
 }
 
 void OLEDDisplay::setTextAlignment(OLEDDISPLAY_TEXT_ALIGNMENT textAlignment)
@@ -988,7 +2656,19 @@ void OLEDDisplay::setTextAlignment(OLEDDISPLAY_TEXT_ALIGNMENT textAlignment)
    this->textAlignment = textAlignment;
 }
 
-void OLEDDisplay::setFont(const char *fontData) { this->fontData = fontData; }
+void OLEDDisplay::setFont(const char *fontData)
+{
+   if (fontData != this->fontData) recordData(OLED_LIST_FONT, &fontData, sizeof(fontData));
+   this->fontData = fontData;
+   loadFontMetrics();
+}
+
+void OLEDDisplay::setFontScale(uint8_t scale)
+{
+   scale = scale < 1 ? 1 : scale > 3 ? 3 : scale;
+   if (scale != fontScale) record(OLED_LIST_FONT_SCALE, scale);
+   fontScale = scale;
+}
 
 void OLEDDisplay::displayOn(void) { sendCommand(DISPLAYON); }
 
@@ -996,13 +2676,12 @@ void OLEDDisplay::displayOff(void) { sendCommand(DISPLAYOFF); }
 
 void OLEDDisplay::sleep()
 {
-    sendCommand(DISPLAYOFF);
 #if (OLEDDISPLAY_CHIPSET == OLEDDISPLAY_TYPE_SH1106)
-    sendCommand(SH1106_PUMP_OFF);
+    const uint8_t commands[] = {DISPLAYOFF, SH1106_PUMP_OFF};
 #else
-    sendCommand(CHARGEPUMP);            // turn off charge pump
-    sendCommand(0x10);
+    const uint8_t commands[] = {DISPLAYOFF, CHARGEPUMP, 0x10};  // turn off charge pump
 #endif
+    sendCommands(commands, sizeof(commands));
     //delay(100);                   // power stabilisation delay
     // power down Vbat
     // delay(50);
@@ -1012,12 +2691,11 @@ void OLEDDisplay::sleep()
 void OLEDDisplay::wake()
 {
 #if (OLEDDISPLAY_CHIPSET == OLEDDISPLAY_TYPE_SH1106)
-    sendCommand(SH1106_PUMP_ON);
+    const uint8_t commands[] = {SH1106_PUMP_ON, DISPLAYON};
 #else
-    sendCommand(CHARGEPUMP);            // 0x8D - enable charge pump
-    sendCommand(0x14);
-#endif    
-    sendCommand(DISPLAYON);
+    const uint8_t commands[] = {CHARGEPUMP, 0x14, DISPLAYON};  // 0x8D - enable charge pump
+#endif
+    sendCommands(commands, sizeof(commands));
     //delay(100);
     display();
 }
@@ -1028,146 +2706,175 @@ void OLEDDisplay::normalDisplay(void) { sendCommand(NORMALDISPLAY); }
 
 void OLEDDisplay::setContrast(char contrast)
 {
-   sendCommand(SETCONTRAST);
-   sendCommand(contrast);
+   const uint8_t commands[] = {SETCONTRAST, (uint8_t)contrast};
+   sendCommands(commands, sizeof(commands));
 }
 
 void OLEDDisplay::flipScreenVertically()
 {
-   sendCommand(SEGREMAP | 0x01);
-   sendCommand(COMSCANDEC);  // Rotate screen 180 Deg
+   const uint8_t commands[] = {SEGREMAP | 0x01, COMSCANDEC};  // Rotate screen 180 Deg
+   sendCommands(commands, sizeof(commands));
 }
 
-void OLEDDisplay::clear(void) { memset(buffer, 0, _display_buffer_size); }
+void OLEDDisplay::setStartLine(uint8_t line) { sendCommand(SETSTARTLINE | (line & 0x3F)); }
+
+void OLEDDisplay::clear(void)
+{
+#ifdef OLEDDISPLAY_DISPLAY_LIST
+   displayListLength   = 0;
+   displayListOverflow = false;
+   listColor           = color;
+   listFont            = fontData;
+   listFontScale       = fontScale;
+#else
+   // Only what was lit since the last clear() changes on the panel
+   for (uint8_t page = 0; page < _display_height / 8; page++)
+   {
+      if (inkMinX[page] < dirtyMinX[page]) dirtyMinX[page] = inkMinX[page];
+      if (inkMaxX[page] > dirtyMaxX[page]) dirtyMaxX[page] = inkMaxX[page];
+      inkMinX[page] = 0xFF;
+      inkMaxX[page] = 0;
+   }
+   memset(buffer, 0, _display_buffer_size);
+#endif
+}
 
 void OLEDDisplay::drawLogBuffer(uint16_t xMove, uint16_t yMove)
 {
-   uint16_t lineHeight = pgm_read_byte(fontData + HEIGHT_POS);
+   if (!logBufferFilled || yMove >= _display_height) return;
+
+   uint16_t lineHeight = getFontHeight();
    // Always align left
    setTextAlignment(TEXT_ALIGN_LEFT);
 
-   // State values
-   uint16_t length  = 0;
-   uint16_t line    = 0;
-   uint16_t lastPos = 0;
+   // The lines after the last '\n' included, as far as they are on the screen
+   uint16_t lines   = logBufferLine + 1;
+   uint16_t visible = (_display_height - yMove + lineHeight - 1) / lineHeight;
+   if (lines > visible) lines = visible;
 
-   for (uint16_t i = 0; i < this->logBufferFilled; i++)
+   uint16_t start = logBufferStart;
+   uint16_t left  = logBufferFilled;
+   for (uint16_t line = 0; line < lines; line++)
    {
-      // Everytime we have a \n print
-      if (this->logBuffer[i] == 10)
-      {
-         length++;
-         // Draw string on line `line` from lastPos to length
-         // Passing 0 as the lenght because we are in TEXT_ALIGN_LEFT
-         drawStringInternal(xMove, yMove + (line++) * lineHeight, &this->logBuffer[lastPos], length,
-                            0);
-         // Remember last pos
-         lastPos = i;
-         // Reset length
-         length = 0;
-      }
-      else
+      if (line == logBufferLine)
       {
-         // Count chars until next linebreak
-         length++;
+         drawLogLine(xMove, yMove + line * lineHeight, start, left);
+         break;
       }
+      // Up to the '\n', it is left out. 0 apart means all of the ring
+      uint16_t next     = logBufferLineStarts[logLineSlot(logBufferFirstLine + line)];
+      uint16_t distance = next > start ? next - start : next + logBufferSize - start;
+      drawLogLine(xMove, yMove + line * lineHeight, start, distance - 1);
+      start = next;
+      left -= distance;
    }
-   // Draw the remaining string
-   if (length > 0)
+}
+
+void OLEDDisplay::drawLogLine(int16_t x, int16_t y, uint16_t start, uint16_t length)
+{
+   uint16_t head = logBufferSize - start;
+   if (length <= head)
    {
-      drawStringInternal(xMove, yMove + line * lineHeight, &this->logBuffer[lastPos], length, 0);
+      if (length) drawStringInternal(x, y, logBuffer + start, length, 0, false);
+      return;
    }
+
+   drawStringInternal(x, y, logBuffer + start, head, 0, false);
+   loadFontMetrics();
+   for (uint16_t i = start; i < logBufferSize; i++) x += getCharWidth(logBuffer[i]);
+   drawStringInternal(x, y, logBuffer, length - head, 0, false);
 }
 
 bool OLEDDisplay::setLogBuffer(uint16_t lines, uint16_t chars)
 {
-   if (logBuffer != NULL) free(logBuffer);
+   if (logBufferLineStarts != NULL) free(logBufferLineStarts);
+   logBufferLineStarts = NULL;
+   logBuffer           = NULL;
+   logBufferSize       = 0;
    uint16_t size = lines * chars;
    if (size > 0)
    {
-      this->logBufferLine     = 0;      // Lines printed
-      this->logBufferMaxLines = lines;  // Lines max printable
-      this->logBufferSize     = size;   // Total number of characters the buffer can hold
-      this->logBuffer         = (char *)malloc(size * sizeof(uint8_t));
-      if (!this->logBuffer)
+      this->logBufferFilled    = 0;      // Characters in the buffer
+      this->logBufferStart     = 0;      // Ring index of the oldest one
+      this->logBufferLine      = 0;      // Lines printed
+      this->logBufferFirstLine = 0;
+      this->logBufferMaxLines  = lines;  // Lines max printable
+      // The line index first, it stays aligned
+      this->logBufferLineStarts = (uint16_t *)malloc(lines * sizeof(uint16_t) + size);
+      if (!this->logBufferLineStarts)
       {
          DEBUG_OLEDDISPLAY(
              "[OLEDDISPLAY][setLogBuffer] Not enough memory to create log "
              "buffer\n");
          return false;
       }
+      this->logBuffer     = (char *)(logBufferLineStarts + lines);
+      this->logBufferSize = size;  // Total number of characters the buffer can hold
    }
    return true;
 }
 
-size_t OLEDDisplay::write(uint8_t c)
+void OLEDDisplay::dropLogLine()
 {
-   if (this->logBufferSize > 0)
-   {
-      // Don't waste space on \r\n line endings, dropping \r
-      if (c == 13) return 1;
-
-      bool maxLineNotReached = this->logBufferLine < this->logBufferMaxLines;
-      bool bufferNotFull     = this->logBufferFilled < this->logBufferSize;
+   uint16_t next     = logBufferLineStarts[logBufferFirstLine];
+   uint16_t distance = next > logBufferStart ? next - logBufferStart : next + logBufferSize - logBufferStart;
+   logBufferStart    = next;
+   logBufferFilled -= distance;
+   logBufferLine--;
+   if (++logBufferFirstLine == logBufferMaxLines) logBufferFirstLine = 0;
+}
 
-      // Can we write to the buffer?
-      if (bufferNotFull && maxLineNotReached)
+inline void OLEDDisplay::appendLog(uint8_t c)
+{
+   // Don't waste space on \r\n line endings, dropping \r
+   if (!logBufferSize || c == 13) return;
+   uint8_t code = logBufferDecoder.next(c);
+   if (!code) return;
+
+   // Max line number is reached
+   if (logBufferLine == logBufferMaxLines) dropLogLine();
+   if (logBufferFilled == logBufferSize)
+   {
+      if (logBufferLine)
       {
-         this->logBuffer[logBufferFilled] = utf8ascii(c);
-         this->logBufferFilled++;
-         // Keep track of lines written
-         if (c == 10) this->logBufferLine++;
+         dropLogLine();
       }
       else
       {
-         // Max line number is reached
-         if (!maxLineNotReached) this->logBufferLine--;
-
-         // Find the end of the first line
-         uint16_t firstLineEnd = 0;
-         for (uint16_t i = 0; i < this->logBufferFilled; i++)
-         {
-            if (this->logBuffer[i] == 10)
-            {
-               // Include last char too
-               firstLineEnd = i + 1;
-               break;
-            }
-         }
-         // If there was a line ending
-         if (firstLineEnd > 0)
-         {
-            // Calculate the new logBufferFilled value
-            this->logBufferFilled = logBufferFilled - firstLineEnd;
-            // Now we move the lines infront of the buffer
-            memcpy(this->logBuffer, &this->logBuffer[firstLineEnd], logBufferFilled);
-         }
-         else
-         {
-            // Let's reuse the buffer if it was full
-            if (!bufferNotFull)
-            {
-               this->logBufferFilled = 0;
-            }  // else {
-               //  Nothing to do here
-               //}
-         }
-         write(c);
+         // One line fills the buffer, keep its end
+         logBufferStart = logIndex(logBufferStart, 1);
+         logBufferFilled--;
       }
    }
+
+   uint16_t pos    = logIndex(logBufferStart, logBufferFilled);
+   logBuffer[pos]  = code;
+   logBufferFilled++;
+   // Keep track of where the lines begin
+   if (c == 10)
+   {
+      logBufferLineStarts[logLineSlot(logBufferFirstLine + logBufferLine)] = logIndex(pos, 1);
+      logBufferLine++;
+   }
+}
+
+size_t OLEDDisplay::write(uint8_t c)
+{
+   appendLog(c);
    // We are always writing all uint8_t to the buffer
    return 1;
 }
 
+size_t OLEDDisplay::write(const uint8_t *data, size_t length)
+{
+   for (size_t i = 0; i < length; i++) appendLog(data[i]);
+   return length;
+}
+
 size_t OLEDDisplay::write(const char *str)
 {
    if (str == NULL) return 0;
-   size_t length = strlen(str);
-   for (size_t i = 0; i < length; i++)
-   {
-      write(str[i]);
-   }
-   return length;
+   return write((const uint8_t *)str, strlen(str));
 }
 
 // Private functions
@@ -1177,341 +2884,714 @@ void OLEDDisplay::sendInitCommands(void)
    //sendCommand(SH1106_SET_PUMP_VOLTAGE); // 0X30
    //sendCommand(SH1106_SET_PUMP_MODE); // 0XAD
    #endif
-   sendCommand(DISPLAYOFF);
-   sendCommand(SETDISPLAYCLOCKDIV);
-   sendCommand(0x80); // sendCommand(0xF0);  // Increase speed of the display max ~96Hz (normally 0x80)
-   sendCommand(SETMULTIPLEX);
-   sendCommand(_display_height - 1);
-   sendCommand(SETDISPLAYOFFSET);
-   sendCommand(0x00);
-   sendCommand(SETSTARTLINE);
-   sendCommand(CHARGEPUMP);
-   sendCommand(0x14);
-   sendCommand(MEMORYMODE);
-   sendCommand(0x00);
-   sendCommand(SEGREMAP | 0x01);
-   sendCommand(COMSCANDEC);  // changed from COMSCANINC
-   sendCommand(SETCOMPINS);
-   sendCommand(0x12);
-   sendCommand(SETCONTRAST);
-   sendCommand(0xCF);
-   sendCommand(SETPRECHARGE);
-   sendCommand(0x1F);             // changed from 0xF1
-   sendCommand(SETVCOMDETECT);  // 0xDB
-   sendCommand(0x40);
-   sendCommand(DISPLAYALLON_RESUME);
-   sendCommand(NORMALDISPLAY);
-   sendCommand(DEACTIVATESCROLL);
-   sendCommand(DISPLAYON);
-}
-
-void inline OLEDDisplay::drawInternal(int16_t xMove, int16_t yMove, int16_t width, int16_t height,
-                                      const char *data, uint16_t offset, uint16_t bytesInData)
-{
-   if (width < 0 || height < 0) return;
-   if (yMove + height < 0 || yMove > _display_height) return;
-   if (xMove + width < 0 || xMove > _display_width) return;
-
-   uint8_t rasterHeight = 1 + ((height - 1) >> 3);  // fast ceil(height / 8.0)
-   int8_t yOffset       = yMove & 7;
-
-   bytesInData = bytesInData == 0 ? width * rasterHeight : bytesInData;
-
-   int16_t initYMove  = yMove;
-   int8_t initYOffset = yOffset;
-
-   for (uint16_t i = 0; i < bytesInData; i++)
-   {
-      // Reset if next horizontal drawing phase is started.
-      if (i % rasterHeight == 0)
+   const uint8_t commands[] = {
+      DISPLAYOFF,
+      SETDISPLAYCLOCKDIV, 0x80,  // 0xF0 increases the speed of the display max ~96Hz (normally 0x80)
+      SETMULTIPLEX, (uint8_t)(_display_height - 1),
+      SETDISPLAYOFFSET, 0x00,
+      SETSTARTLINE,
+      CHARGEPUMP, 0x14,
+      MEMORYMODE, 0x00,
+      SEGREMAP | 0x01,
+      COMSCANDEC,  // changed from COMSCANINC
+      SETCOMPINS, 0x12,
+      SETCONTRAST, 0xCF,
+      SETPRECHARGE, 0x1F,  // changed from 0xF1
+      SETVCOMDETECT, 0x40,  // 0xDB
+      DISPLAYALLON_RESUME,
+      NORMALDISPLAY,
+      DEACTIVATESCROLL,
+      DISPLAYON,
+   };
+   sendCommands(commands, sizeof(commands));
+}
+
+bool OLEDDisplay::setupBlit(OLEDBlit &blit, int16_t xMove, int16_t yMove, int16_t width,
+                            int16_t height, uint16_t bytesInData)
+{
+   if (width < 0 || height <= 0) return false;
+   if (yMove + height <= 0 || yMove >= _display_height) return false;
+   if (xMove + width <= 0 || xMove >= _display_width) return false;
+
+   blit.rasterHeight = 1 + ((height - 1) >> 3);  // fast ceil(height / 8.0)
+   bytesInData       = bytesInData == 0 ? width * blit.rasterHeight : bytesInData;
+
+   // Clip the source columns once against the screen, the last column may
+   // be cut short by the font encoder
+   int16_t columns     = (bytesInData + blit.rasterHeight - 1) / blit.rasterHeight;
+   int16_t firstColumn = (xMove < 0) ? -xMove : 0;
+   int16_t endColumn   = (xMove + columns > _display_width) ? _display_width - xMove : columns;
+   if (firstColumn >= endColumn) return false;
+
+   blit.firstColumn     = firstColumn;
+   blit.columns         = endColumn - firstColumn;
+   blit.lastColumnBytes = (endColumn == columns) ? bytesInData - (columns - 1) * blit.rasterHeight
+                                                 : blit.rasterHeight;
+
+   // Source row r lands shifted by `shift` on page `page + r`, the bits that
+   // fall out of the bottom of that byte go to page `page + r + 1`
+   int16_t page   = yMove >> 3;
+   int16_t pages  = _display_height >> 3;
+   blit.shift     = yMove & 7;
+   blit.lowStart  = (page < 0) ? -page : 0;
+   blit.lowEnd    = min((int16_t)blit.rasterHeight, (int16_t)(pages - page));
+   blit.highStart = (page < -1) ? -page - 1 : 0;
+   blit.highEnd   = min((int16_t)blit.rasterHeight, (int16_t)(pages - page - 1));
+   if (blit.shift == 0) blit.highEnd = 0;
+
+   markDirty(max(page, (int16_t)0), min((int16_t)(page + blit.rasterHeight - (blit.shift == 0)), (int16_t)(pages - 1)),
+             xMove + firstColumn, xMove + endColumn - 1);
+
+   uint8_t *column = buffer + xMove + firstColumn;
+   blit.lowTarget  = column + (page + blit.lowStart) * _display_width;
+   blit.highTarget = (blit.highStart < blit.highEnd)
+                         ? column + (page + blit.highStart + 1) * _display_width
+                         : column;
+   return true;
+}
+
+void OLEDDisplay::runBlit(const OLEDBlit &blit)
+{
+   if (blit.shift == 0)
+   {
+      switch (color)
       {
-         yMove   = initYMove;
-         yOffset = initYOffset;
+         case WHITE:   blitColumns<WHITE, true>(blit);   break;
+         case BLACK:   blitColumns<BLACK, true>(blit);   break;
+         case INVERSE: blitColumns<INVERSE, true>(blit); break;
       }
+   }
+   else
+   {
+      switch (color)
+      {
+         case WHITE:   blitColumns<WHITE, false>(blit);   break;
+         case BLACK:   blitColumns<BLACK, false>(blit);   break;
+         case INVERSE: blitColumns<INVERSE, false>(blit); break;
+      }
+   }
+}
 
-      byte currentByte = pgm_read_byte(data + offset + i);
+void OLEDDisplay::drawInternal(int16_t xMove, int16_t yMove, int16_t width, int16_t height,
+                               const char *data, uint16_t offset, uint16_t bytesInData)
+{
+   OLEDBlit blit;
+   if (!setupBlit(blit, xMove, yMove, width, height, bytesInData)) return;
 
-      int16_t xPos = xMove + (i / rasterHeight);
-      int16_t yPos = ((yMove >> 3) + (i % rasterHeight)) * _display_width;
+   blit.source = data + offset + blit.firstColumn * blit.rasterHeight;
+   runBlit(blit);
+   yield();
+}
 
-      int16_t yScreenPos = yMove + yOffset;
-      int16_t dataPos    = xPos + yPos;
+void OLEDDisplay::drawRleGlyph(int16_t xMove, int16_t yMove, int16_t width, int16_t height,
+                               const char *data, uint8_t size)
+{
+   OLEDBlit blit;
+   if (!setupBlit(blit, xMove, yMove, width, height, 0)) return;
+
+   // Every column is decoded into `rows` and blitted from there as a bitmap
+   // one column wide, the columns left of the screen are decoded and dropped.
+   // setupBlit() clipped the rows to the screen
+   uint8_t rows[32];  // up to 255 rows
+   OLEDRleGlyph glyph(data, size, height);
+   int16_t endColumn    = blit.firstColumn + blit.columns;
+   blit.source          = (const char *)rows;
+   blit.columns         = 1;
+   blit.lastColumnBytes = blit.rasterHeight;
+   for (int16_t column = 0; column < endColumn && glyph.column(rows); column++)
+   {
+      if (column < blit.firstColumn) continue;
+      runBlit(blit);
+      blit.lowTarget++;
+      blit.highTarget++;
+   }
+   yield();
+}
 
-      if (dataPos >= 0 && dataPos < _display_buffer_size && xPos >= 0 && xPos < _display_width)
+void OLEDDisplay::drawScaledGlyph(int16_t xMove, int16_t yMove, int16_t width, int16_t height,
+                                  const char *data, uint8_t size, bool rle)
+{
+   uint8_t scale        = fontScale;
+   uint8_t rasterHeight = 1 + ((height - 1) >> 3);
+   int16_t columns      = rle ? width : (size + rasterHeight - 1) / rasterHeight;
+   OLEDBlit blit;
+   if (!setupBlit(blit, xMove, yMove, columns * scale, height * scale, 0)) return;
+
+   blit.source = data;
+   if (blit.shift == 0)
+   {
+      switch (color)
       {
-         if (yOffset >= 0)
+         case WHITE:   blitScaled<WHITE, true>(blit, size, height, rle);   break;
+         case BLACK:   blitScaled<BLACK, true>(blit, size, height, rle);   break;
+         case INVERSE: blitScaled<INVERSE, true>(blit, size, height, rle); break;
+      }
+   }
+   else
+   {
+      switch (color)
+      {
+         case WHITE:   blitScaled<WHITE, false>(blit, size, height, rle);   break;
+         case BLACK:   blitScaled<BLACK, false>(blit, size, height, rle);   break;
+         case INVERSE: blitScaled<INVERSE, false>(blit, size, height, rle); break;
+      }
+   }
+   yield();
+}
+
+template <OLEDDISPLAY_COLOR blitColor, bool pageAligned>
+void OLEDDisplay::blitScaled(const OLEDBlit &blit, uint8_t size, uint8_t height, bool rle)
+{
+   // Locals, the stores into the buffer could alias blit and this
+   const char *data     = blit.source;
+   const char *dataEnd  = data + size;
+   uint8_t scale        = fontScale;
+   uint8_t rasterHeight = 1 + ((height - 1) >> 3);
+   uint8_t shiftUp      = blit.shift;
+   uint8_t shiftDown    = 8 - blit.shift;
+   uint8_t start        = blit.lowStart;
+   uint8_t end          = pageAligned ? blit.lowEnd : blit.highEnd + 1;  // pages from lowStart
+   uint16_t stride      = _display_width;
+   int16_t firstColumn  = blit.firstColumn;
+   int16_t endColumn    = firstColumn + blit.columns;
+   uint8_t *lowTarget   = blit.lowTarget;
+
+   // Each source column is stretched once and blitted into the `scale`
+   // columns it covers, as far as they are on screen. Bytes without pixels
+   // change nothing in any color and are skipped.
+   // Only the source rows firstRow to endRow reach the pages on screen (and
+   // the one above them for the spill), a glyph may be taller than the
+   // screen. stretched[i] is the stretched page firstRow * scale + i, the
+   // window ends in a 0 for the spill of the last page
+   uint8_t firstRow = (pageAligned || start == 0 ? start : start - 1) / scale;
+   uint8_t endRow   = min((uint8_t)((end + scale - 1) / scale), rasterHeight);
+   uint8_t window   = (endRow - firstRow) * scale;
+   uint8_t base     = firstRow * scale;
+   if (endRow <= firstRow) return;
+   uint8_t rows[32];  // up to 255 rows
+   uint8_t stretched[OLEDDISPLAY_MAX_PAGES + 2 + 2 * 2 + 1];
+   OLEDRleGlyph glyph(data, size, height);
+   int16_t column = rle || firstColumn == 0 ? 0 : firstColumn / scale;
+   for (; column * scale < endColumn; column++)
+   {
+      if (rle)
+      {
+         if (!glyph.column(rows)) break;
+      }
+      else
+      {
+         // The last column may be cut short by the font encoder
+         const char *source = data + column * rasterHeight;
+         uint8_t available  = dataEnd - source < rasterHeight ? dataEnd - source : rasterHeight;
+         for (uint8_t i = firstRow; i < endRow; i++)
          {
-            switch (this->color)
-            {
-               case WHITE:
-                  buffer[dataPos] |= currentByte << yOffset;
-                  break;
-               case BLACK:
-                  buffer[dataPos] &= ~(currentByte << yOffset);
-                  break;
-               case INVERSE:
-                  buffer[dataPos] ^= currentByte << yOffset;
-                  break;
-            }
-            if (dataPos < (_display_buffer_size - _display_width))
-            {
-               switch (this->color)
-               {
-                  case WHITE:
-                     buffer[dataPos + _display_width] |= currentByte >> (8 - yOffset);
-                     break;
-                  case BLACK:
-                     buffer[dataPos + _display_width] &= ~(currentByte >> (8 - yOffset));
-                     break;
-                  case INVERSE:
-                     buffer[dataPos + _display_width] ^= currentByte >> (8 - yOffset);
-                     break;
-               }
-            }
+            rows[i] = i < available ? pgm_read_byte(source + i) : 0;
          }
-         else
+      }
+      int16_t from = max((int16_t)(column * scale), firstColumn);
+      int16_t to   = min((int16_t)(column * scale + scale), endColumn);
+      if (from >= to) continue;
+      oledScaleColumn(stretched, rows + firstRow, endRow - firstRow, scale);
+      stretched[window] = 0;
+      uint8_t copies    = to - from;
+
+      // Unlike blitColumns() the shifted row and the spill of the row above
+      // are merged, every page is written once
+      uint8_t *target = lowTarget + (from - firstColumn);
+      for (uint8_t page = start; page < end; page++)
+      {
+         uint8_t *row = stretched + (page - base);
+         uint8_t bits = pageAligned ? row[0] : (uint8_t)(row[0] << shiftUp);
+         if (!pageAligned && page > 0) bits |= row[-1] >> shiftDown;
+         if (bits)
          {
-            // Make new offset position
-            yOffset = -yOffset;
-
-            switch (this->color)
-            {
-               case WHITE:
-                  buffer[dataPos] |= currentByte >> yOffset;
-                  break;
-               case BLACK:
-                  buffer[dataPos] &= ~(currentByte >> yOffset);
-                  break;
-               case INVERSE:
-                  buffer[dataPos] ^= currentByte >> yOffset;
-                  break;
-            }
-
-            // Prepare for next iteration by moving one block up
-            yMove -= 8;
-
-            // and setting the new yOffset
-            yOffset = 8 - yOffset;
+            // 1 to 3 columns
+            oledBlitByte<blitColor>(target[0], bits);
+            if (copies > 1) oledBlitByte<blitColor>(target[1], bits);
+            if (copies > 2) oledBlitByte<blitColor>(target[2], bits);
          }
-
-         yield();
+         target += stride;
       }
    }
 }
 
-// Code form http://playground.arduino.cc/Main/Utf8ascii
-uint8_t OLEDDisplay::utf8ascii(byte ascii)
+template <OLEDDISPLAY_COLOR blitColor, bool pageAligned>
+void OLEDDisplay::blitColumns(const OLEDBlit &blit)
 {
-   static uint8_t LASTCHAR;
-
-   if (ascii < 128)
-   {  // Standard ASCII-set 0..0x7F handling
-      LASTCHAR = 0;
-      return ascii;
-   }
-
-   uint8_t last = LASTCHAR;  // get last char
-   LASTCHAR     = ascii;
-
-   switch (last)
-   {  // conversion depnding on first UTF8-character
-      case 0xC2:
-         return (ascii);
-         break;
-      case 0xC3:
-         return (ascii | 0xC0);
-         break;
-      case 0x82:
-         if (ascii == 0xAC) return (0x80);  // special case Euro-symbol
+   if (pageAligned)
+   {
+      // Source row r is page r, copied page by page: the bytes of a page
+      // are rasterHeight apart in the source and side by side on screen.
+      // Only the last column may lack the lower rows
+      uint8_t *target = blit.lowTarget;
+      for (uint8_t r = blit.lowStart; r < blit.lowEnd; r++)
+      {
+         const char *source = blit.source + r;
+         int16_t columns    = r < blit.lastColumnBytes ? blit.columns : blit.columns - 1;
+         for (int16_t column = 0; column < columns; column++)
+         {
+            oledBlitByte<blitColor>(target[column], pgm_read_byte(source));
+            source += blit.rasterHeight;
+         }
+         target += _display_width;
+      }
+      return;
    }
 
-   return 0;  // otherwise: return zero, if character has to be ignored
-}
-
-// You need to free the char!
-char *OLEDDisplay::utf8ascii(String str)
-{
-   uint16_t k      = 0;
-   uint16_t length = str.length() + 1;
+   const char *source  = blit.source;
+   uint8_t *lowTarget  = blit.lowTarget;
+   uint8_t *highTarget = blit.highTarget;
+   uint8_t shiftUp     = blit.shift;
+   uint8_t shiftDown   = 8 - blit.shift;
 
-   // Copy the string into a char array
-   char *s = (char *)malloc(length * sizeof(char));
-   if (!s)
+   for (int16_t column = 0; column < blit.columns; column++)
    {
-      DEBUG_OLEDDISPLAY(
-          "[OLEDDISPLAY][utf8ascii] Can't allocate another char array. Drop "
-          "support for UTF-8.\n");
-      return (char *)str.c_str();
-   }
-   str.toCharArray(s, length);
+      uint8_t rows = (column == blit.columns - 1) ? blit.lastColumnBytes : blit.rasterHeight;
 
-   length--;
+      uint8_t *target = lowTarget;
+      uint8_t end     = min(blit.lowEnd, rows);
+      for (uint8_t r = blit.lowStart; r < end; r++)
+      {
+         oledBlitByte<blitColor>(*target, (uint8_t)(pgm_read_byte(source + r) << shiftUp));
+         target += _display_width;
+      }
 
-   for (uint16_t i = 0; i < length; i++)
-   {
-      char c = utf8ascii(s[i]);
-      if (c != 0)
+      target = highTarget;
+      end    = min(blit.highEnd, rows);
+      for (uint8_t r = blit.highStart; r < end; r++)
       {
-         s[k++] = c;
+         oledBlitByte<blitColor>(*target, pgm_read_byte(source + r) >> shiftDown);
+         target += _display_width;
       }
-   }
 
-   s[k] = 0;
+      source += blit.rasterHeight;
+      lowTarget++;
+      highTarget++;
+   }
+}
 
-   // This will leak 's' be sure to free it in the calling function.
-   return s;
+// Code form http://playground.arduino.cc/Main/Utf8ascii
+uint8_t OLEDDisplay::utf8ascii(byte ascii)
+{
+   static OLEDUtf8Decoder decoder;
+   return decoder.next(ascii);
 }
 
 void OLEDDisplay::display(void)
 {
-   uint8_t minBoundY = 0xFF;
-   uint8_t maxBoundY = 0x00;
+   while (displayBusy()) yield();
 
-   uint8_t minBoundX = 0xFF;
-   uint8_t maxBoundX = 0x00;
+#ifdef OLEDDISPLAY_DISPLAY_LIST
+   flushDisplayList();
+#else
+   prepareFlush();
+   OLEDFlushStep step;
+   while (nextFlushStep(step))
+   {
+      sendFlushStep(step);
+      yield();
+   }
+#endif
+}
 
-#ifdef OLEDDISPLAY_DOUBLE_BUFFER
-   // Calculate the Y bounding box of changes
-   // and copy buffer[pos] to buffer_back[pos];
-   for (uint8_t y = 0; y < (_display_height / 8); y++)
+void OLEDDisplay::prepareFlush()
+{
+   uint8_t pages = _display_height / 8;
+
+#if defined(OLEDDISPLAY_DOUBLE_BUFFER)
+   // Narrow every dirty span down to the bytes that differ from what was
+   // sent last time and copy buffer[pos] to buffer_back[pos]
+   for (uint8_t page = 0; page < pages; page++)
    {
-      for (uint8_t x = 0; x < _display_width; x++)
+      uint8_t minX = 0xFF;
+      uint8_t maxX = 0x00;
+      for (uint16_t x = dirtyMinX[page]; x <= dirtyMaxX[page]; x++)
       {
-         uint16_t pos = x + y * _display_width;
-         if (buffer[pos] != buffer_back[pos])
+         uint16_t pos = x + page * _display_width;
+         if (buffer[pos] != buffer_back[pos] || fullFlush)
          {
-            minBoundY = min(minBoundY, y);
-            maxBoundY = max(maxBoundY, y);
-            minBoundX = min(minBoundX, x);
-            maxBoundX = max(maxBoundX, x);
+            if (minX == 0xFF) minX = x;
+            maxX = x;
          }
          buffer_back[pos] = buffer[pos];
       }
-      yield();
+      dirtyMinX[page] = minX;
+      dirtyMaxX[page] = maxX;
    }
+   yield();
+#elif defined(OLEDDISPLAY_PAGE_HASH)
+   for (uint8_t page = 0; page < pages; page++) hashDirtySpan(page, buffer + page * _display_width);
+#endif
+   fullFlush = false;
+
+   flushPage        = 0;
+   flushWindowFirst = 0xFF;
+   flushWindowLast  = 0;
+   if (display_mode != OLEDDISPLAY_DISPLAY_NORMAL) return;
+
+   // Every address window costs 6 command bytes. Send the bounding box of
+   // the dirty spans as one window unless that drags in more clean bytes
+   // than the extra windows would cost
+   uint8_t firstPage  = 0xFF;
+   uint8_t lastPage   = 0;
+   uint8_t minX       = 0xFF;
+   uint8_t maxX       = 0;
+   uint16_t spanBytes = 0;
+   for (uint8_t page = 0; page < pages; page++)
+   {
+      if (dirtyMinX[page] > dirtyMaxX[page]) continue;
+      if (firstPage == 0xFF) firstPage = page;
+      lastPage = page;
+      minX = min(minX, dirtyMinX[page]);
+      maxX = max(maxX, dirtyMaxX[page]);
+      spanBytes += dirtyMaxX[page] - dirtyMinX[page] + 1 + 6;
+   }
+   if (firstPage == 0xFF) return;
+
+   uint16_t boxBytes = (lastPage - firstPage + 1) * (maxX - minX + 1) + 6;
+   if (boxBytes > spanBytes) return;
 
-   // If the minBoundY wasn't updated
-   // we can savely assume that buffer_back[pos] == buffer[pos]
-   // holdes true for all values of pos
-   if (minBoundY == 0xFF) return;
+   flushWindowFirst = firstPage;
+   flushWindowLast  = lastPage;
+   for (uint8_t page = firstPage; page <= lastPage; page++)
+   {
+      dirtyMinX[page] = minX;
+      dirtyMaxX[page] = maxX;
+   }
+}
+
+#ifdef OLEDDISPLAY_PAGE_HASH
+void OLEDDisplay::hashDirtySpan(uint8_t page, const uint8_t *pageData)
+{
+   // Re-hash the segments under the dirty span and narrow the span down to
+   // the segments whose hash changed since they were last sent
+   if (dirtyMinX[page] > dirtyMaxX[page]) return;
+
+   const uint8_t segment = OLEDDISPLAY_PAGE_HASH_SEGMENT;
+   uint8_t segments      = (_display_width + segment - 1) / segment;
+   uint8_t minX          = 0xFF;
+   uint8_t maxX          = 0x00;
+   for (uint8_t s = dirtyMinX[page] / segment; s <= dirtyMaxX[page] / segment; s++)
+   {
+      uint8_t x      = s * segment;
+      uint8_t length = min(segment, _display_width - x);
+      uint32_t hash  = oledSegmentHash(pageData + x, length);
+      uint32_t &sent = page_hashes[page * segments + s];
+      if (hash == sent && !fullFlush) continue;
+
+      sent = hash;
+      if (minX == 0xFF) minX = max(x, dirtyMinX[page]);
+      maxX = min((uint8_t)(x + length - 1), dirtyMaxX[page]);
+   }
+   dirtyMinX[page] = minX;
+   dirtyMaxX[page] = maxX;
+}
 #endif
-   switch (display_mode)
+
+void OLEDDisplay::addressFlushStep(OLEDFlushStep &step, uint8_t firstPage, uint8_t lastPage,
+                                   uint8_t minX, uint8_t maxX)
+{
+   if (display_mode != OLEDDISPLAY_DISPLAY_NORMAL)
    {
-      case OLEDDISPLAY_DISPLAY_NORMAL:
-         // Note : minBound{X,Y} and maxBound{X,Y} are only used when double buffering
-         displayNormal(minBoundX, maxBoundX, minBoundY, maxBoundY);
-         break;
-      default:
-         displayPaged(minBoundX, maxBoundX, minBoundY, maxBoundY);
+      // The visible window starts at GRAM column 0x20 on a 64 pixel wide
+      // SSD1306 and at column 2 on a SH1106
+      const uint8_t columnOffset = (((0x12 - (uint8_t)OLEDDISPLAY_CHIPSET) & 0x0F) << 4) | (uint8_t)OLEDDISPLAY_CHIPSET;
+      uint8_t column = columnOffset + minX;
+      step.commands[0]   = 0xB0 | ((firstPage + gramPage) & 7);  // page address
+      step.commands[1]   = column & 0x0F;                         // column address
+      step.commands[2]   = 0x10 | (column >> 4);
+      step.commandLength = 3;
+      return;
    }
+
+   step.commands[0]   = COLUMNADDR;
+   step.commands[1]   = minX;
+   step.commands[2]   = maxX;
+   step.commands[3]   = PAGEADDR;
+   step.commands[4]   = firstPage + gramPage;
+   step.commands[5]   = lastPage + gramPage;
+   step.commandLength = 6;
 }
 
-void OLEDDisplay::displayNormal(uint8_t minBoundX, uint8_t maxBoundX, uint8_t minBoundY, uint8_t maxBoundY)
+bool OLEDDisplay::nextFlushStep(OLEDFlushStep &step)
 {
-#ifdef OLEDDISPLAY_DOUBLE_BUFFER
-   sendCommand(COLUMNADDR);
-   sendCommand(minBoundX);
-   sendCommand(maxBoundX);
+   uint8_t pages = _display_height / 8;
+   while (flushPage < pages && dirtyMinX[flushPage] > dirtyMaxX[flushPage]) flushPage++;
+   if (flushPage >= pages) return false;
 
-   sendCommand(PAGEADDR);
-   sendCommand(minBoundY);
-   sendCommand(maxBoundY);
+   uint8_t page = flushPage++;
+   uint8_t minX = dirtyMinX[page];
+   uint8_t maxX = dirtyMaxX[page];
+   dirtyMinX[page] = 0xFF;
+   dirtyMaxX[page] = 0x00;
 
-   #if (OLEDDISPLAY_MODE !=OLEDDISPLAY_MODE_SPI)
-   startDataWrite();
-   uint8_t k = 0;
-   #endif
-   for (uint16_t y = minBoundY; y <= maxBoundY; y++)
+   step.commandLength = 0;
+   step.dataStart     = page * _display_width + minX;
+   step.dataLength    = maxX - minX + 1;
+
+   // Only NORMAL mode plans shared windows, flushWindowFirst is 0xFF otherwise
+   bool shared = page >= flushWindowFirst && page <= flushWindowLast;
+   if (shared && page > flushWindowFirst) return true;  // continues the open window
+
+   addressFlushStep(step, page, shared ? flushWindowLast : page, minX, maxX);
+
+   if (shared && minX == 0 && maxX == _display_width - 1)
    {
-      #if (OLEDDISPLAY_MODE == OLEDDISPLAY_MODE_SPI)
-      sendData(buffer, y * _display_width + minBoundX, maxBoundX - minBoundX);
-      #else
-      uint16_t x = 0;
-      for (x = 0; x <= maxBoundX - minBoundX; x+= TRANSFER_BLOCK_SIZE)
+      // Full width pages are contiguous in the buffer, send them in one go
+      for (; flushPage <= flushWindowLast; flushPage++)
       {
-        sendData(buffer, y * _display_width + minBoundX, maxBoundX - minBoundX);
+         dirtyMinX[flushPage] = 0xFF;
+         dirtyMaxX[flushPage] = 0x00;
       }
-      sendData(buffer, y * _display_width + x, (maxBoundX - minBoundX) - x);
-      #endif
-      yield();
+      step.dataLength = (flushWindowLast - page + 1) * _display_width;
    }
-   #if (OLEDDISPLAY_MODE != OLEDDISPLAY_MODE_SPI)
-   if (k != 0)
+   return true;
+}
+
+#ifdef OLEDDISPLAY_DISPLAY_LIST
+template <typename... Args>
+bool OLEDDisplay::recordData(uint8_t op, const void *data, uint16_t length, Args... args)
+{
+   if (displayListReplay) return false;
+
+   // Once an entry didn't fit the rest of the frame is dropped as well, a
+   // later smaller one would be drawn without what came before it
+   uint16_t size = 1 + 2 * sizeof...(args) + length;
+   if (displayListOverflow || size > OLEDDISPLAY_DISPLAY_LIST - displayListLength)
    {
-      endDataWrite();
+      displayListOverflow = true;
+      return true;
    }
-   #endif
-#else
-   sendCommand(COLUMNADDR);
-   sendCommand(0x0);
-   sendCommand(_display_width - 1);
-
-   sendCommand(PAGEADDR);
-   sendCommand(0x0);
-   sendCommand((_display_height / 8) - 1);
 
-   #if(OLEDDISPLAY_MODE == OLEDDISPLAY_MODE_SPI)
-   sendData(buffer, 0, _display_buffer_size);
-   #else  // I2C or BRZO
-   for (uint16_t i = 0; i < _display_buffer_size; i += TRANSFER_BLOCK_SIZE)
+   const int16_t values[] = {(int16_t)args..., 0};
+   uint8_t *entry         = displayList + displayListLength;
+   *entry++               = op;
+   for (uint8_t i = 0; i < sizeof...(args); i++)
    {
-      sendData(buffer, i, TRANSFER_BLOCK_SIZE);
+      *entry++ = values[i];
+      *entry++ = values[i] >> 8;
    }
-   #endif
-#endif
+   if (length) memcpy(entry, data, length);
+   displayListLength += size;
+   return true;
 }
 
-void OLEDDisplay::displayPaged(uint8_t minBoundX, uint8_t maxBoundX, uint8_t minBoundY, uint8_t maxBoundY)
+void OLEDDisplay::renderPage(uint8_t page)
 {
-#ifdef OLEDDISPLAY_DOUBLE_BUFFER
-
-   #if (OLEDDISPLAY_MODE != OLEDDISPLAY_MODE_SPI)
-   startDataWrite();
-   uint8_t k = 0;
-   #endif
-
-   for (uint16_t y = minBoundY; y <= maxBoundY; y++)
+   OLEDDISPLAY_COLOR frameColor              = color;
+   OLEDDISPLAY_TEXT_ALIGNMENT frameAlignment = textAlignment;
+   const char *frameFont                     = fontData;
+   uint8_t frameFontScale                    = fontScale;
+   uint8_t height                            = _display_height;
+
+   // A screen of one page, the draw functions clip against it and write to
+   // page 0 of `buffer`. Every entry is moved up by the pages above
+   color             = listColor;
+   fontData          = listFont;
+   fontScale         = listFontScale;
+   textAlignment     = TEXT_ALIGN_LEFT;
+   _display_height   = 8;
+   displayListReplay = true;
+   memset(buffer, 0, _display_width);
+
+   int16_t top            = page * 8;
+   const uint8_t *entry   = displayList;
+   const uint8_t *listEnd = displayList + displayListLength;
+   auto pointer           = [&]() {
+      const char *value;
+      memcpy(&value, entry, sizeof(value));
+      entry += sizeof(value);
+      return value;
+   };
+   while (entry < listEnd)
    {
-      sendCommand(0xB0 | y);        // send page address
-      sendCommand((minBoundX + (uint8_t)OLEDDISPLAY_CHIPSET)&(0x0F);  // send column address
-      sendCommand((0x12 - (uint8_t)OLEDDISPLAY_CHIPSET)|(minBoundX >> 4));
+      uint8_t op = *entry++;
+      int16_t a[5];
+      for (uint8_t i = 0; i < pgm_read_byte(oledListArgs + op); i++, entry += 2)
+      {
+         a[i] = (int16_t)(entry[0] | (entry[1] << 8));
+      }
 
-      #if (OLEDDISPLAY_MODE == OLEDDISPLAY_MODE_SPI)
-      sendData(buffer, y * _display_width + minBoundX, maxBoundX - minBoundX);
-      #else
-      uint16_t x = 0;
-      for (x = 0; x <= maxBoundX - minBoundX; x+= TRANSFER_BLOCK_SIZE)
+      switch (op)
       {
-        sendData(buffer, y * _display_width + minBoundX, maxBoundX - minBoundX);
+         case OLED_LIST_COLOR:
+            color = (OLEDDISPLAY_COLOR)a[0];
+            break;
+         case OLED_LIST_FONT:
+            fontData = pointer();
+            break;
+         case OLED_LIST_FONT_SCALE:
+            fontScale = a[0];
+            break;
+         case OLED_LIST_PIXEL:
+            setPixel(a[0], a[1] - top);
+            break;
+         case OLED_LIST_LINE:
+            drawLine(a[0], a[1] - top, a[2], a[3] - top);
+            break;
+         case OLED_LIST_RECT:
+            drawRect(a[0], a[1] - top, a[2], a[3]);
+            break;
+         case OLED_LIST_FILL_RECT:
+            fillRect(a[0], a[1] - top, a[2], a[3]);
+            break;
+         case OLED_LIST_CIRCLE:
+            drawCircle(a[0], a[1] - top, a[2]);
+            break;
+         case OLED_LIST_CIRCLE_QUADS:
+            drawCircleQuads(a[0], a[1] - top, a[2], a[3]);
+            break;
+         case OLED_LIST_FILL_CIRCLE:
+            fillCircle(a[0], a[1] - top, a[2]);
+            break;
+         case OLED_LIST_ROUND_RECT:
+            drawRoundRect(a[0], a[1] - top, a[2], a[3], a[4]);
+            break;
+         case OLED_LIST_FILL_ROUND_RECT:
+            fillRoundRect(a[0], a[1] - top, a[2], a[3], a[4]);
+            break;
+         case OLED_LIST_HLINE:
+            drawHorizontalLine(a[0], a[1] - top, a[2]);
+            break;
+         case OLED_LIST_VLINE:
+            drawVerticalLine(a[0], a[1] - top, a[2]);
+            break;
+         case OLED_LIST_IMAGE:
+            drawFastImage(a[0], a[1] - top, a[2], a[3], pointer());
+            break;
+         case OLED_LIST_XBM:
+            drawXbm(a[0], a[1] - top, a[2], a[3], pointer());
+            break;
+         case OLED_LIST_TEXT:
+         case OLED_LIST_CODES:
+            drawStringInternal(a[0], a[1] - top, (const char *)entry, a[2], 0, op == OLED_LIST_TEXT);
+            entry += (uint16_t)a[2];
+            break;
       }
-      sendData(buffer, y * _display_width + x, (maxBoundX - minBoundX) - x);
-      #endif
+   }
+
+   displayListReplay = false;
+   _display_height   = height;
+   color             = frameColor;
+   textAlignment     = frameAlignment;
+   fontData          = frameFont;
+   fontScale         = frameFontScale;
+}
+
+void OLEDDisplay::flushDisplayList()
+{
+   uint8_t pages = _display_height / 8;
+   OLEDFlushStep step;
+   for (uint8_t page = 0; page < pages; page++)
+   {
+      renderPage(page);
+      dirtyMinX[page] = 0;
+      dirtyMaxX[page] = _display_width - 1;
+#ifdef OLEDDISPLAY_PAGE_HASH
+      hashDirtySpan(page, buffer);
+      if (dirtyMinX[page] > dirtyMaxX[page]) continue;
+#endif
+      step.dataStart  = dirtyMinX[page];
+      step.dataLength = dirtyMaxX[page] - dirtyMinX[page] + 1;
+      addressFlushStep(step, page, page, dirtyMinX[page], dirtyMaxX[page]);
+      sendFlushStep(step);
       yield();
-   }   
-   #if (OLEDDISPLAY_MODE !=OLEDDISPLAY_MODE_SPI)
-   if (k != 0)
+   }
+   fullFlush = false;
+}
+#endif
+
+void OLEDDisplay::sendBufferChunks(uint16_t start, uint16_t length)
+{
+   for (uint16_t i = 0; i < length; i += TRANSFER_BLOCK_SIZE)
    {
-      endDataWrite();
+      sendData(buffer, start + i, (length - i < TRANSFER_BLOCK_SIZE) ? length - i : TRANSFER_BLOCK_SIZE);
    }
-   #endif
-#else
-   for (uint8_t r = 0; r < _display_height / 8; r++)
+}
+
+#ifdef OLEDDISPLAY_ASYNC_TRANSPORT
+void OLEDDisplay::displayAsync(OLEDFlushCallback callback)
+{
+   while (displayBusy()) yield();
+
+   prepareFlush();
+   asyncCallback     = callback;
+   asyncStep.commandLength = 0;
+   asyncStep.dataLength    = 0;
+   asyncIndex        = 0;
+   asyncInFlight     = 0;
+   asyncPendingValid = false;
+   asyncIsData       = false;
+   asyncBusy         = true;
+
+   // The first fill runs in thread context. READY may already be raised
+   // while it loads the second stage, so the interrupt stays masked until
+   // asyncFill() returns and services those events afterwards
+   asyncStart();
+   asyncSetDC(false);
+   asyncFill();
+   if (asyncBusy) asyncEnableInterrupt();
+}
+
+bool OLEDDisplay::displayBusy() { return asyncBusy; }
+
+void OLEDDisplay::asyncInterrupt()
+{
+   asyncInFlight--;
+   asyncFill();
+}
+
+bool OLEDDisplay::asyncNextByte(uint8_t &value, bool &isData)
+{
+   while (asyncIndex >= asyncStep.commandLength + asyncStep.dataLength)
    {
-      sendCommand(0xB0 | r);        // send page address
-      sendCommand(0x00 + (uint8_t)OLEDDISPLAY_CHIPSET);  // send column address
-      sendCommand(0x12 - (uint8_t)OLEDDISPLAY_CHIPSET);
+      if (!nextFlushStep(asyncStep)) return false;
+      asyncIndex = 0;
+   }
+   isData = asyncIndex >= asyncStep.commandLength;
+   value  = isData ? buffer[asyncStep.dataStart + asyncIndex - asyncStep.commandLength]
+                   : asyncStep.commands[asyncIndex];
+   asyncIndex++;
+   return true;
+}
 
-      #if (OLEDDISPLAY_MODE == OLEDDISPLAY_MODE_SPI)
-      sendData(buffer, r * _display_width, _display_width);
-      #else  // I2C or BRZO
-      for (uint16_t c = r * _display_width; c < (r + 1) * _display_width; c += TRANSFER_BLOCK_SIZE)
+void OLEDDisplay::asyncFill()
+{
+   // Keep both stages of TXD loaded. DC is sampled with the last bit of a
+   // byte, so it may only flip once everything queued has been shifted out
+   while (asyncInFlight < 2)
+   {
+      if (!asyncPendingValid)
       {
-         sendData(buffer, c, TRANSFER_BLOCK_SIZE);
+         if (!asyncNextByte(asyncPending, asyncPendingIsData)) break;
+         asyncPendingValid = true;
       }
-      #endif
-      yield();
+      if (asyncPendingIsData != asyncIsData)
+      {
+         if (asyncInFlight) return;
+         asyncIsData = asyncPendingIsData;
+         asyncSetDC(asyncIsData);
+      }
+      asyncTransmit(asyncPending);
+      asyncInFlight++;
+      asyncPendingValid = false;
    }
-#endif
+   if (asyncInFlight || asyncPendingValid) return;
+
+   asyncFinish();
+   asyncBusy = false;
+   if (asyncCallback) asyncCallback();
+}
+#else
+void OLEDDisplay::displayAsync(OLEDFlushCallback callback)
+{
+   display();
+   if (callback) callback();
 }
 
+bool OLEDDisplay::displayBusy() { return false; }
+
+void OLEDDisplay::asyncInterrupt() {}
+#endif
+
 #endif
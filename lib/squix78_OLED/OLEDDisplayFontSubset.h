@@ -0,0 +1,236 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2016 by Daniel Eichhorn
+ * Copyright (c) 2016 by Fabrice Weinberg
+ * Copyright (c) 2017 by Mark Cooke
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Compile time font subsets
+//
+//   typedef OLEDFontSubset<ArialMT_Plain_10, '0', '1', '2', '3', '4', '5', '6',
+//                          '7', '8', '9', ':', '.'> ClockFont;
+//   display.setFont(ClockFont::data);
+//
+// ClockFont::data is an ordinary font array, built by the compiler from the
+// full font. Its jump table spans only the lowest to the highest requested
+// char and only the glyphs of the requested chars are stored, packed one
+// after the other. The other chars in that span keep their advance but are
+// not drawable, like the space of the built in fonts. As long as nothing
+// else references the full font array the linker drops it.
+//
+// The full font has to be declared constexpr (the built in fonts are) so
+// the compiler may read it. Works on FONT_RLE fonts as well, the glyph data
+// is copied as it is. Include this after the display header (SSD1306Spi.h
+// etc.), it uses the font format constants of OLEDDisplay.h.
+
+#ifndef OLEDDISPLAYFONTSUBSET_h
+#define OLEDDISPLAYFONTSUBSET_h
+
+#ifndef JUMPTABLE_START
+#error "include OLEDDisplayFontSubset.h after the display header"
+#endif
+
+template <uint16_t... I>
+struct OLEDIndexList
+{
+};
+
+template <class A, class B>
+struct OLEDIndexConcat;
+
+template <uint16_t... A, uint16_t... B>
+struct OLEDIndexConcat<OLEDIndexList<A...>, OLEDIndexList<B...> >
+{
+   typedef OLEDIndexList<A..., (sizeof...(A) + B)...> type;
+};
+
+// 0..N-1, split in halves to keep the template depth at log2(N)
+template <uint16_t N>
+struct OLEDMakeIndices
+{
+   typedef typename OLEDIndexConcat<typename OLEDMakeIndices<N / 2>::type,
+                                    typename OLEDMakeIndices<N - N / 2>::type>::type type;
+};
+
+template <>
+struct OLEDMakeIndices<0>
+{
+   typedef OLEDIndexList<> type;
+};
+
+template <>
+struct OLEDMakeIndices<1>
+{
+   typedef OLEDIndexList<0> type;
+};
+
+// The pieces of the subset as C++11 constexpr functions (one return each).
+// They read the full font directly, it is never touched at run time.
+namespace OLEDFontSubsetBuilder
+{
+constexpr uint8_t byteAt(const char *font, uint16_t pos) { return (uint8_t)font[pos]; }
+
+constexpr bool contains(uint8_t) { return false; }
+
+template <class... Tail>
+constexpr bool contains(uint8_t code, char head, Tail... tail)
+{
+   return (uint8_t)head == code || contains(code, tail...);
+}
+
+constexpr uint8_t lowest(uint8_t result) { return result; }
+
+template <class... Tail>
+constexpr uint8_t lowest(uint8_t result, char head, Tail... tail)
+{
+   return lowest((uint8_t)head < result ? (uint8_t)head : result, tail...);
+}
+
+constexpr uint8_t highest(uint8_t result) { return result; }
+
+template <class... Tail>
+constexpr uint8_t highest(uint8_t result, char head, Tail... tail)
+{
+   return highest((uint8_t)head > result ? (uint8_t)head : result, tail...);
+}
+
+constexpr bool inFont(const char *) { return true; }
+
+template <class... Tail>
+constexpr bool inFont(const char *font, char head, Tail... tail)
+{
+   return (uint8_t)head >= byteAt(font, FIRST_CHAR_POS) &&
+          (uint8_t)head - byteAt(font, FIRST_CHAR_POS) < byteAt(font, CHAR_NUM_POS) &&
+          inFont(font, tail...);
+}
+
+constexpr uint16_t entry(const char *font, uint8_t code)
+{
+   return JUMPTABLE_START + (code - byteAt(font, FIRST_CHAR_POS)) * JUMPTABLE_BYTES;
+}
+
+constexpr bool drawable(const char *font, uint8_t code)
+{
+   return !(byteAt(font, entry(font, code)) == 0xFF &&
+            byteAt(font, entry(font, code) + JUMPTABLE_LSB) == 0xFF);
+}
+
+// Bytes the subset stores for a char, 0 if it is left out
+template <class... Chars>
+constexpr uint8_t glyphSize(const char *font, uint8_t code, Chars... chars)
+{
+   return contains(code, chars...) && drawable(font, code)
+              ? byteAt(font, entry(font, code) + JUMPTABLE_SIZE)
+              : 0;
+}
+
+// Offset of the glyph of `code` in the subset data, the sum over [from, code)
+template <class... Chars>
+constexpr uint16_t glyphOffset(const char *font, uint8_t from, uint8_t code, Chars... chars)
+{
+   return from >= code ? 0
+                       : glyphSize(font, from, chars...) +
+                             glyphOffset(font, from + 1, code, chars...);
+}
+
+// Byte `field` of the subset jump table entry of `code`
+template <class... Chars>
+constexpr uint8_t jumpTable(const char *font, uint8_t low, uint8_t code, uint8_t field,
+                            Chars... chars)
+{
+   return field == JUMPTABLE_WIDTH ? byteAt(font, entry(font, code) + JUMPTABLE_WIDTH)
+          : !glyphSize(font, code, chars...) ? (field == JUMPTABLE_SIZE ? 0 : 0xFF)
+          : field == JUMPTABLE_SIZE ? glyphSize(font, code, chars...)
+          : field == JUMPTABLE_LSB ? glyphOffset(font, low, code, chars...) & 0xFF
+                                   : glyphOffset(font, low, code, chars...) >> 8;
+}
+
+constexpr uint16_t glyphStart(const char *font, uint8_t code)
+{
+   return JUMPTABLE_START + byteAt(font, CHAR_NUM_POS) * JUMPTABLE_BYTES +
+          ((byteAt(font, entry(font, code)) << 8) | byteAt(font, entry(font, code) + JUMPTABLE_LSB));
+}
+
+// Byte `pos` of the packed glyph data, found by walking the chars from `code`
+template <class... Chars>
+constexpr uint8_t glyphData(const char *font, uint8_t code, uint16_t pos, Chars... chars)
+{
+   return pos < glyphSize(font, code, chars...)
+              ? byteAt(font, glyphStart(font, code) + pos)
+              : glyphData(font, code + 1, pos - glyphSize(font, code, chars...), chars...);
+}
+
+template <class... Chars>
+constexpr uint8_t subsetByte(const char *font, uint16_t pos, Chars... chars)
+{
+   return pos == WIDTH_POS ? byteAt(font, WIDTH_POS)
+          : pos == HEIGHT_POS ? byteAt(font, HEIGHT_POS)
+          : pos == FIRST_CHAR_POS ? lowest(0xFF, chars...)
+          : pos == CHAR_NUM_POS ? highest(0, chars...) - lowest(0xFF, chars...) + 1
+          : pos < JUMPTABLE_START + (highest(0, chars...) - lowest(0xFF, chars...) + 1) * JUMPTABLE_BYTES
+              ? jumpTable(font, lowest(0xFF, chars...),
+                          lowest(0xFF, chars...) + (pos - JUMPTABLE_START) / JUMPTABLE_BYTES,
+                          (pos - JUMPTABLE_START) % JUMPTABLE_BYTES, chars...)
+              : glyphData(font, lowest(0xFF, chars...),
+                          pos - JUMPTABLE_START -
+                              (highest(0, chars...) - lowest(0xFF, chars...) + 1) * JUMPTABLE_BYTES,
+                          chars...);
+}
+
+template <const char *font, class Indices, char... chars>
+struct Data;
+
+template <const char *font, uint16_t... I, char... chars>
+struct Data<font, OLEDIndexList<I...>, chars...>
+{
+   static const char data[sizeof...(I)];
+};
+
+template <const char *font, uint16_t... I, char... chars>
+const char Data<font, OLEDIndexList<I...>, chars...>::data[sizeof...(I)] PROGMEM = {
+    (char)subsetByte(font, I, chars...)...};
+}  // namespace OLEDFontSubsetBuilder
+
+template <const char *font, char... chars>
+struct OLEDFontSubset
+{
+   static_assert(sizeof...(chars) > 0, "a font subset needs at least one char");
+   static_assert(OLEDFontSubsetBuilder::inFont(font, chars...), "char is not in the font");
+
+   static const uint8_t firstChar = OLEDFontSubsetBuilder::lowest(0xFF, chars...);
+   static const uint8_t charNum   = OLEDFontSubsetBuilder::highest(0, chars...) - firstChar + 1;
+   static const uint16_t size =
+       JUMPTABLE_START + charNum * JUMPTABLE_BYTES +
+       OLEDFontSubsetBuilder::glyphOffset(font, firstChar, firstChar + charNum - 1, chars...) +
+       OLEDFontSubsetBuilder::glyphSize(font, firstChar + charNum - 1, chars...);
+
+   typedef OLEDFontSubsetBuilder::Data<font, typename OLEDMakeIndices<size>::type, chars...> Data;
+
+   // The font array for setFont()
+   static constexpr const char *data = Data::data;
+};
+
+template <const char *font, char... chars>
+constexpr const char *OLEDFontSubset<font, chars...>::data;
+
+#endif
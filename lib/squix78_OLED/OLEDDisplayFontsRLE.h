@@ -0,0 +1,1277 @@
+// Generated by tools/fontrle.py from OLEDDisplayFonts.h
+#ifndef OLEDDISPLAYFONTS_RLE_h
+#define OLEDDISPLAYFONTS_RLE_h
+
+constexpr char ArialMT_Plain_10_RLE[] PROGMEM = {
+  0x8A, // Width: 10, run length encoded
+  0x0D, // Height: 13
+  0x20, // First Char: 32
+  0xE0, // Numbers of Chars: 224
+
+  // Jump Table:
+  0xFF, 0xFF, 0x00, 0x03,  // 32:65535
+  0x00, 0x00, 0x03, 0x03,  // 33:0
+  0x00, 0x03, 0x03, 0x04,  // 34:3
+  0x00, 0x06, 0x08, 0x06,  // 35:6
+  0x00, 0x0E, 0x0B, 0x06,  // 36:14
+  0x00, 0x19, 0x0D, 0x09,  // 37:25
+  0x00, 0x26, 0x10, 0x07,  // 38:38
+  0x00, 0x36, 0x01, 0x02,  // 39:54
+  0x00, 0x37, 0x05, 0x03,  // 40:55
+  0x00, 0x3C, 0x05, 0x03,  // 41:60
+  0x00, 0x41, 0x05, 0x04,  // 42:65
+  0x00, 0x46, 0x05, 0x06,  // 43:70
+  0x00, 0x4B, 0x02, 0x03,  // 44:75
+  0x00, 0x4D, 0x02, 0x03,  // 45:77
+  0x00, 0x4F, 0x02, 0x03,  // 46:79
+  0x00, 0x51, 0x03, 0x03,  // 47:81
+  0x00, 0x54, 0x08, 0x06,  // 48:84
+  0x00, 0x5C, 0x04, 0x06,  // 49:92
+  0x00, 0x60, 0x0C, 0x06,  // 50:96
+  0x00, 0x6C, 0x0C, 0x06,  // 51:108
+  0x00, 0x78, 0x09, 0x06,  // 52:120
+  0x00, 0x81, 0x0C, 0x06,  // 53:129
+  0x00, 0x8D, 0x0C, 0x06,  // 54:141
+  0x00, 0x99, 0x07, 0x06,  // 55:153
+  0x00, 0xA0, 0x0D, 0x06,  // 56:160
+  0x00, 0xAD, 0x0C, 0x06,  // 57:173
+  0x00, 0xB9, 0x03, 0x03,  // 58:185
+  0x00, 0xBC, 0x03, 0x03,  // 59:188
+  0x00, 0xBF, 0x08, 0x06,  // 60:191
+  0x00, 0xC7, 0x0A, 0x06,  // 61:199
+  0x00, 0xD1, 0x08, 0x06,  // 62:209
+  0x00, 0xD9, 0x09, 0x06,  // 63:217
+  0x00, 0xE2, 0x1B, 0x0A,  // 64:226
+  0x00, 0xFD, 0x0A, 0x07,  // 65:253
+  0x01, 0x07, 0x0C, 0x07,  // 66:263
+  0x01, 0x13, 0x0A, 0x07,  // 67:275
+  0x01, 0x1D, 0x09, 0x07,  // 68:285
+  0x01, 0x26, 0x0E, 0x07,  // 69:294
+  0x01, 0x34, 0x07, 0x06,  // 70:308
+  0x01, 0x3B, 0x0D, 0x08,  // 71:315
+  0x01, 0x48, 0x06, 0x07,  // 72:328
+  0x01, 0x4E, 0x02, 0x03,  // 73:334
+  0x01, 0x50, 0x04, 0x05,  // 74:336
+  0x01, 0x54, 0x09, 0x07,  // 75:340
+  0x01, 0x5D, 0x06, 0x06,  // 76:349
+  0x01, 0x63, 0x08, 0x08,  // 77:355
+  0x01, 0x6B, 0x06, 0x07,  // 78:363
+  0x01, 0x71, 0x0B, 0x08,  // 79:369
+  0x01, 0x7C, 0x09, 0x07,  // 80:380
+  0x01, 0x85, 0x0C, 0x08,  // 81:389
+  0x01, 0x91, 0x0A, 0x07,  // 82:401
+  0x01, 0x9B, 0x0E, 0x07,  // 83:411
+  0x01, 0xA9, 0x06, 0x06,  // 84:425
+  0x01, 0xAF, 0x06, 0x07,  // 85:431
+  0x01, 0xB5, 0x07, 0x07,  // 86:437
+  0x01, 0xBC, 0x09, 0x09,  // 87:444
+  0x01, 0xC5, 0x0B, 0x07,  // 88:453
+  0x01, 0xD0, 0x07, 0x07,  // 89:464
+  0x01, 0xD7, 0x0F, 0x06,  // 90:471
+  0x01, 0xE6, 0x04, 0x03,  // 91:486
+  0x01, 0xEA, 0x03, 0x03,  // 92:490
+  0x01, 0xED, 0x03, 0x03,  // 93:493
+  0x01, 0xF0, 0x05, 0x05,  // 94:496
+  0x01, 0xF5, 0x06, 0x06,  // 95:501
+  0x01, 0xFB, 0x02, 0x03,  // 96:507
+  0x01, 0xFD, 0x09, 0x06,  // 97:509
+  0x02, 0x06, 0x07, 0x06,  // 98:518
+  0x02, 0x0D, 0x08, 0x05,  // 99:525
+  0x02, 0x15, 0x07, 0x06,  // 100:533
+  0x02, 0x1C, 0x0A, 0x06,  // 101:540
+  0x02, 0x26, 0x04, 0x03,  // 102:550
+  0x02, 0x2A, 0x0A, 0x06,  // 103:554
+  0x02, 0x34, 0x05, 0x06,  // 104:564
+  0x02, 0x39, 0x03, 0x02,  // 105:569
+  0x02, 0x3C, 0x03, 0x02,  // 106:572
+  0x02, 0x3F, 0x05, 0x05,  // 107:575
+  0x02, 0x44, 0x02, 0x02,  // 108:580
+  0x02, 0x46, 0x08, 0x08,  // 109:582
+  0x02, 0x4E, 0x05, 0x06,  // 110:590
+  0x02, 0x53, 0x07, 0x06,  // 111:595
+  0x02, 0x5A, 0x07, 0x06,  // 112:602
+  0x02, 0x61, 0x07, 0x06,  // 113:609
+  0x02, 0x68, 0x03, 0x03,  // 114:616
+  0x02, 0x6B, 0x0A, 0x05,  // 115:619
+  0x02, 0x75, 0x04, 0x03,  // 116:629
+  0x02, 0x79, 0x05, 0x06,  // 117:633
+  0x02, 0x7E, 0x05, 0x05,  // 118:638
+  0x02, 0x83, 0x07, 0x07,  // 119:643
+  0x02, 0x8A, 0x09, 0x05,  // 120:650
+  0x02, 0x93, 0x06, 0x05,  // 121:659
+  0x02, 0x99, 0x0B, 0x05,  // 122:665
+  0x02, 0xA4, 0x05, 0x03,  // 123:676
+  0x02, 0xA9, 0x02, 0x03,  // 124:681
+  0x02, 0xAB, 0x05, 0x03,  // 125:683
+  0x02, 0xB0, 0x05, 0x06,  // 126:688
+  0xFF, 0xFF, 0x00, 0x00,  // 127:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 128:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 129:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 130:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 131:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 132:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 133:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 134:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 135:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 136:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 137:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 138:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 139:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 140:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 141:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 142:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 143:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 144:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 145:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 146:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 147:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 148:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 149:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 150:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 151:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 152:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 153:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 154:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 155:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 156:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 157:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 158:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 159:65535
+  0xFF, 0xFF, 0x00, 0x03,  // 160:65535
+  0x02, 0xB5, 0x03, 0x03,  // 161:693
+  0x02, 0xB8, 0x08, 0x06,  // 162:696
+  0x02, 0xC0, 0x0E, 0x06,  // 163:704
+  0x02, 0xCE, 0x07, 0x06,  // 164:718
+  0x02, 0xD5, 0x0B, 0x06,  // 165:725
+  0x02, 0xE0, 0x03, 0x03,  // 166:736
+  0x02, 0xE3, 0x12, 0x06,  // 167:739
+  0x02, 0xF5, 0x03, 0x03,  // 168:757
+  0x02, 0xF8, 0x11, 0x07,  // 169:760
+  0x03, 0x09, 0x07, 0x04,  // 170:777
+  0x03, 0x10, 0x07, 0x06,  // 171:784
+  0x03, 0x17, 0x05, 0x06,  // 172:791
+  0x03, 0x1C, 0x02, 0x03,  // 173:796
+  0x03, 0x1E, 0x0F, 0x07,  // 174:798
+  0x03, 0x2D, 0x06, 0x06,  // 175:813
+  0x03, 0x33, 0x05, 0x04,  // 176:819
+  0x03, 0x38, 0x09, 0x05,  // 177:824
+  0x03, 0x41, 0x06, 0x03,  // 178:833
+  0x03, 0x47, 0x06, 0x03,  // 179:839
+  0x03, 0x4D, 0x03, 0x03,  // 180:845
+  0x03, 0x50, 0x05, 0x06,  // 181:848
+  0x03, 0x55, 0x05, 0x05,  // 182:853
+  0x03, 0x5A, 0x02, 0x03,  // 183:858
+  0x03, 0x5C, 0x04, 0x03,  // 184:860
+  0x03, 0x60, 0x03, 0x03,  // 185:864
+  0x03, 0x63, 0x06, 0x04,  // 186:867
+  0x03, 0x69, 0x07, 0x06,  // 187:873
+  0x03, 0x70, 0x0D, 0x08,  // 188:880
+  0x03, 0x7D, 0x0F, 0x08,  // 189:893
+  0x03, 0x8C, 0x0F, 0x08,  // 190:908
+  0x03, 0x9B, 0x08, 0x06,  // 191:923
+  0x03, 0xA3, 0x0C, 0x07,  // 192:931
+  0x03, 0xAF, 0x0C, 0x07,  // 193:943
+  0x03, 0xBB, 0x0D, 0x07,  // 194:955
+  0x03, 0xC8, 0x0E, 0x07,  // 195:968
+  0x03, 0xD6, 0x0C, 0x07,  // 196:982
+  0x03, 0xE2, 0x0B, 0x07,  // 197:994
+  0x03, 0xED, 0x11, 0x0A,  // 198:1005
+  0x03, 0xFE, 0x0C, 0x07,  // 199:1022
+  0x04, 0x0A, 0x10, 0x07,  // 200:1034
+  0x04, 0x1A, 0x10, 0x07,  // 201:1050
+  0x04, 0x2A, 0x10, 0x07,  // 202:1066
+  0x04, 0x3A, 0x10, 0x07,  // 203:1082
+  0x04, 0x4A, 0x03, 0x03,  // 204:1098
+  0x04, 0x4D, 0x03, 0x03,  // 205:1101
+  0x04, 0x50, 0x03, 0x03,  // 206:1104
+  0x04, 0x53, 0x03, 0x03,  // 207:1107
+  0x04, 0x56, 0x0B, 0x07,  // 208:1110
+  0x04, 0x61, 0x09, 0x07,  // 209:1121
+  0x04, 0x6A, 0x0D, 0x08,  // 210:1130
+  0x04, 0x77, 0x0D, 0x08,  // 211:1143
+  0x04, 0x84, 0x0E, 0x08,  // 212:1156
+  0x04, 0x92, 0x0F, 0x08,  // 213:1170
+  0x04, 0xA1, 0x0D, 0x08,  // 214:1185
+  0x04, 0xAE, 0x09, 0x06,  // 215:1198
+  0x04, 0xB7, 0x0F, 0x08,  // 216:1207
+  0x04, 0xC6, 0x08, 0x07,  // 217:1222
+  0x04, 0xCE, 0x08, 0x07,  // 218:1230
+  0x04, 0xD6, 0x09, 0x07,  // 219:1238
+  0x04, 0xDF, 0x08, 0x07,  // 220:1247
+  0x04, 0xE7, 0x09, 0x07,  // 221:1255
+  0x04, 0xF0, 0x09, 0x07,  // 222:1264
+  0x04, 0xF9, 0x0B, 0x06,  // 223:1273
+  0x05, 0x04, 0x0B, 0x06,  // 224:1284
+  0x05, 0x0F, 0x0B, 0x06,  // 225:1295
+  0x05, 0x1A, 0x0C, 0x06,  // 226:1306
+  0x05, 0x26, 0x0D, 0x06,  // 227:1318
+  0x05, 0x33, 0x0B, 0x06,  // 228:1331
+  0x05, 0x3E, 0x0D, 0x06,  // 229:1342
+  0x05, 0x4B, 0x12, 0x09,  // 230:1355
+  0x05, 0x5D, 0x0A, 0x05,  // 231:1373
+  0x05, 0x67, 0x0C, 0x06,  // 232:1383
+  0x05, 0x73, 0x0C, 0x06,  // 233:1395
+  0x05, 0x7F, 0x0D, 0x06,  // 234:1407
+  0x05, 0x8C, 0x0C, 0x06,  // 235:1420
+  0x05, 0x98, 0x04, 0x03,  // 236:1432
+  0x05, 0x9C, 0x03, 0x03,  // 237:1436
+  0x05, 0x9F, 0x04, 0x03,  // 238:1439
+  0x05, 0xA3, 0x03, 0x03,  // 239:1443
+  0x05, 0xA6, 0x08, 0x06,  // 240:1446
+  0x05, 0xAE, 0x09, 0x06,  // 241:1454
+  0x05, 0xB7, 0x09, 0x06,  // 242:1463
+  0x05, 0xC0, 0x09, 0x06,  // 243:1472
+  0x05, 0xC9, 0x0A, 0x06,  // 244:1481
+  0x05, 0xD3, 0x0B, 0x06,  // 245:1491
+  0x05, 0xDE, 0x09, 0x06,  // 246:1502
+  0x05, 0xE7, 0x07, 0x05,  // 247:1511
+  0x05, 0xEE, 0x09, 0x06,  // 248:1518
+  0x05, 0xF7, 0x07, 0x06,  // 249:1527
+  0x05, 0xFE, 0x07, 0x06,  // 250:1534
+  0x06, 0x05, 0x08, 0x06,  // 251:1541
+  0x06, 0x0D, 0x07, 0x06,  // 252:1549
+  0x06, 0x14, 0x08, 0x05,  // 253:1556
+  0x06, 0x1C, 0x07, 0x06,  // 254:1564
+  0x06, 0x23, 0x08, 0x05,  // 255:1571
+
+  // Font Data:
+  0xF1,0x51,0x10,  // 33
+  0x33,0xF8,0x30,  // 34
+  0x51,0x13,0x83,0x83,0x13,0x83,0x83,0x11,  // 35
+  0x42,0x21,0x71,0x11,0x31,0x68,0x51,0x21,0x21,0x71,0x22,  // 36
+  0xF2,0x2A,0x12,0x1A,0x22,0x29,0x29,0x21,0x27,0x12,0x12,0x1A,0x20,  // 37
+  0x72,0x81,0x11,0x21,0x61,0x12,0x21,0x61,0x11,0x11,0x11,0x62,0x31,0xB3,0xA1,0x11,  // 38
+  0x33,  // 39
+  0x55,0x71,0x51,0x51,0x71,  // 40
+  0x31,0x71,0x51,0x51,0x75,  // 41
+  0x31,0x11,0xA2,0xB1,0x11,  // 42
+  0x61,0xC1,0xA5,0xA1,0xC1,  // 43
+  0xF7,0x20,  // 44
+  0x71,0xC1,  // 45
+  0xF7,0x10,  // 46
+  0x82,0x83,0x82,  // 47
+  0x45,0x71,0x51,0x61,0x51,0x61,0x51,0x75,  // 48
+  0xF3,0x1B,0x1B,0x70,  // 49
+  0x41,0x41,0x61,0x42,0x61,0x31,0x11,0x61,0x21,0x21,0x72,0x31,  // 50
+  0x41,0x31,0x71,0x51,0x61,0x21,0x21,0x61,0x21,0x21,0x72,0x12,  // 51
+  0x62,0xA1,0x11,0x91,0x21,0x81,0x31,0x87,0xA1,  // 52
+  0x52,0x11,0x73,0x31,0x61,0x11,0x31,0x61,0x11,0x31,0x61,0x23,  // 53
+  0x45,0x71,0x11,0x31,0x61,0x11,0x31,0x61,0x11,0x31,0x71,0x13,  // 54
+  0x31,0xC1,0x42,0x61,0x22,0x83,0xA1,  // 55
+  0x42,0x12,0x71,0x21,0x21,0x61,0x21,0x21,0x61,0x21,0x21,0x72,0x12,  // 56
+  0x43,0x11,0x71,0x31,0x11,0x61,0x31,0x11,0x61,0x31,0x11,0x75,  // 57
+  0xF3,0x13,0x10,  // 58
+  0xF3,0x13,0x20,  // 59
+  0xF4,0x1B,0x11,0x1A,0x11,0x19,0x13,0x10,  // 60
+  0x51,0x11,0xA1,0x11,0xA1,0x11,0xA1,0x11,0xA1,0x11,  // 61
+  0xF2,0x13,0x19,0x11,0x1A,0x11,0x1B,0x10,  // 62
+  0x41,0xB1,0xC1,0xC1,0x22,0x11,0x61,0x21,0xA2,  // 63
+  0xF4,0x47,0x24,0x16,0x11,0x32,0x14,0x11,0x13,0x11,0x14,0x11,0x13,0x11,0x14,0x12,0x41,0x14,0x11,0x22,0x11,0x15,0x13,0x11,0x17,0x32,0x10,  // 64
+  0x91,0x93,0x82,0x11,0x81,0x31,0x92,0x11,0xB3,0xD1,  // 65
+  0xF1,0x76,0x12,0x12,0x16,0x12,0x12,0x16,0x12,0x12,0x17,0x50,  // 66
+  0xF2,0x57,0x15,0x16,0x15,0x16,0x15,0x17,0x13,0x10,  // 67
+  0xF1,0x76,0x15,0x16,0x15,0x17,0x13,0x19,0x30,  // 68
+  0xF1,0x76,0x12,0x12,0x16,0x12,0x12,0x16,0x12,0x12,0x16,0x12,0x12,0x10,  // 69
+  0xF1,0x76,0x12,0x19,0x12,0x19,0x10,  // 70
+  0xF3,0x39,0x13,0x17,0x15,0x16,0x12,0x12,0x17,0x11,0x11,0x1A,0x20,  // 71
+  0xF1,0x79,0x1C,0x1C,0x19,0x70,  // 72
+  0xF1,0x70,  // 73
+  0x82,0xC1,0xC1,0x66,  // 74
+  0xF1,0x7A,0x1A,0x2A,0x12,0x18,0x14,0x1D,0x10,  // 75
+  0xF1,0x7C,0x1C,0x1C,0x1C,0x10,  // 76
+  0xF1,0x77,0x2D,0x3D,0x19,0x38,0x2A,0x70,  // 77
+  0xF1,0x77,0x2D,0x1D,0x27,0x70,  // 78
+  0xF2,0x57,0x15,0x16,0x15,0x16,0x15,0x16,0x15,0x17,0x50,  // 79
+  0xF1,0x76,0x12,0x19,0x12,0x19,0x12,0x1A,0x20,  // 80
+  0xF2,0x57,0x15,0x16,0x15,0x16,0x14,0x26,0x14,0x27,0x41,0x10,  // 81
+  0xF1,0x76,0x12,0x19,0x12,0x19,0x12,0x29,0x22,0x20,  // 82
+  0xF2,0x22,0x17,0x12,0x12,0x16,0x12,0x12,0x16,0x12,0x12,0x17,0x12,0x20,  // 83
+  0xF1,0x1C,0x1C,0x76,0x1C,0x10,  // 84
+  0xF1,0x6D,0x1C,0x1C,0x16,0x60,  // 85
+  0x31,0xD3,0xD2,0xD1,0xA2,0x83,0x91,  // 86
+  0x32,0xD4,0xD1,0x75,0x71,0xD5,0xD1,0x84,0x72,  // 87
+  0x91,0x61,0x41,0x81,0x21,0xA2,0xA1,0x21,0x81,0x41,0xD1,  // 88
+  0x31,0xD1,0xD1,0xD4,0x81,0xB1,0xB1,  // 89
+  0x31,0x42,0x61,0x31,0x11,0x61,0x22,0x11,0x61,0x12,0x21,0x63,0x31,0x62,0x41,  // 90
+  0xF1,0x94,0x17,0x10,  // 91
+  0x32,0xD3,0xD2,  // 92
+  0x31,0x71,0x49,  // 93
+  0x61,0xA2,0xA1,0xD2,0xD1,  // 94
+  0xB1,0xC1,0xC1,0xC1,0xC1,0xC1,  // 95
+  0x31,0xD1,  // 96
+  0xF6,0x28,0x11,0x11,0x18,0x11,0x11,0x18,0x50,  // 97
+  0xF1,0x78,0x13,0x18,0x13,0x19,0x30,  // 98
+  0xF4,0x39,0x13,0x18,0x13,0x19,0x11,0x10,  // 99
+  0xF4,0x39,0x13,0x18,0x13,0x16,0x70,  // 100
+  0xF4,0x39,0x11,0x11,0x18,0x11,0x11,0x19,0x21,0x10,  // 101
+  0x51,0xB6,0x61,0x11,  // 102
+  0xF4,0x31,0x17,0x13,0x11,0x16,0x13,0x11,0x16,0x60,  // 103
+  0xF1,0x78,0x1C,0x1D,0x40,  // 104
+  0xF1,0x11,0x50,  // 105
+  0xB1,0x41,0x16,  // 106
+  0x37,0xA1,0xB3,0x91,0x31,  // 107
+  0xF1,0x70,  // 108
+  0xF3,0x58,0x1C,0x1C,0x58,0x1C,0x1D,0x40,  // 109
+  0xF3,0x58,0x1C,0x1D,0x40,  // 110
+  0xF4,0x39,0x13,0x18,0x13,0x19,0x30,  // 111
+  0xF3,0x76,0x13,0x18,0x13,0x19,0x30,  // 112
+  0xF4,0x39,0x13,0x18,0x13,0x18,0x70,  // 113
+  0xF3,0x58,0x10,  // 114
+  0x61,0x21,0x81,0x11,0x11,0x81,0x11,0x11,0x81,0x21,  // 115
+  0x51,0xA7,0x81,0x31,  // 116
+  0xF3,0x4D,0x1C,0x18,0x50,  // 117
+  0x51,0xD3,0xD1,0x93,0x91,  // 118
+  0x54,0xD1,0x93,0x91,0xD3,0xD1,0x84,  // 119
+  0x51,0x31,0x91,0x11,0xB1,0xB1,0x11,0x91,0x31,  // 120
+  0x51,0xD3,0x21,0xA2,0x83,0x91,  // 121
+  0x51,0x31,0x81,0x22,0x81,0x11,0x11,0x82,0x21,0x81,0x31,  // 122
+  0x71,0x84,0x14,0x41,0x71,  // 123
+  0xF1,0x90,  // 124
+  0x31,0x71,0x44,0x14,0x81,  // 125
+  0x62,0xB1,0xC2,0xC1,0xB2,  // 126
+  0xF3,0x11,0x50,  // 161
+  0xF4,0x39,0x11,0x54,0x42,0x19,0x11,0x10,  // 162
+  0x61,0x21,0x73,0x12,0x61,0x22,0x11,0x61,0x21,0x21,0x61,0x51,0x71,0x41,  // 163
+  0xF3,0x49,0x12,0x19,0x12,0x19,0x40,  // 164
+  0x31,0x21,0x11,0x83,0x11,0xA4,0x73,0x11,0x71,0x21,0x11,  // 165
+  0xF1,0x32,0x40,  // 166
+  0x41,0x12,0x21,0x51,0x11,0x21,0x21,0x41,0x21,0x11,0x21,0x41,0x21,0x21,0x11,0x51,0x22,0x11,  // 167
+  0x31,0xFA,0x10,  // 168
+  0x53,0x91,0x31,0x71,0x21,0x21,0x61,0x11,0x11,0x11,0x61,0x11,0x11,0x11,0x71,0x31,0x93,  // 169
+  0x31,0x12,0x91,0x12,0x91,0x12,0x94,  // 170
+  0xF5,0x2A,0x12,0x1A,0x2A,0x12,0x10,  // 171
+  0x51,0xC1,0xC1,0xC1,0xC3,  // 172
+  0x71,0xC1,  // 173
+  0x53,0x91,0x31,0x71,0x13,0x11,0x61,0x12,0x21,0x61,0x22,0x11,0x71,0x31,0x93,  // 174
+  0x11,0xC1,0xC1,0xC1,0xC1,0xC1,  // 175
+  0xF1,0x3A,0x11,0x1A,0x30,  // 176
+  0x61,0x21,0x91,0x21,0x76,0x91,0x21,0x91,0x21,  // 177
+  0x31,0x21,0x91,0x12,0x92,0x11,  // 178
+  0x31,0x21,0x92,0x11,0x91,0x12,  // 179
+  0xF2,0x1B,0x10,  // 180
+  0xF3,0x7A,0x1C,0x18,0x50,  // 181
+  0x43,0x99,0x41,0xC9,0x41,  // 182
+  0xF4,0x10,  // 183
+  0xF8,0x11,0x1B,0x20,  // 184
+  0xF2,0x1B,0x40,  // 185
+  0x42,0xA1,0x21,0x91,0x21,0xA2,  // 186
+  0xF4,0x12,0x1A,0x2A,0x12,0x1A,0x20,  // 187
+  0xF2,0x14,0x16,0x41,0x1A,0x2A,0x12,0x18,0x12,0x27,0x12,0x4B,0x10,  // 188
+  0xF2,0x14,0x16,0x41,0x1B,0x1A,0x2A,0x11,0x12,0x16,0x12,0x11,0x29,0x21,0x10,  // 189
+  0x31,0x21,0x92,0x11,0x91,0x12,0x12,0xA1,0xA2,0x11,0x81,0x22,0x71,0x24,0xB1,  // 190
+  0xF7,0x2A,0x12,0x16,0x11,0x22,0x1B,0x10,  // 191
+  0x91,0x93,0x82,0x11,0x51,0x21,0x31,0x61,0x22,0x11,0xB3,0xD1,  // 192
+  0x91,0x93,0x82,0x11,0x61,0x11,0x31,0x51,0x32,0x11,0xB3,0xD1,  // 193
+  0x91,0x93,0x51,0x22,0x11,0x51,0x21,0x31,0x61,0x22,0x11,0xB3,0xD1,  // 194
+  0x91,0x41,0x43,0x41,0x32,0x11,0x61,0x11,0x31,0x51,0x32,0x11,0xB3,0xD1,  // 195
+  0x91,0x93,0x51,0x22,0x11,0x81,0x31,0x61,0x22,0x11,0xB3,0xD1,  // 196
+  0x91,0x93,0x55,0x11,0x61,0x11,0x31,0x65,0x11,0xB3,0xD1,  // 197
+  0x82,0x92,0xA3,0x82,0x21,0x81,0x31,0x87,0x61,0x21,0x21,0x61,0x21,0x21,0x61,0x21,0x21,  // 198
+  0xF2,0x57,0x15,0x16,0x15,0x21,0x13,0x15,0x11,0x24,0x13,0x10,  // 199
+  0xF1,0x73,0x12,0x12,0x12,0x14,0x11,0x12,0x12,0x16,0x12,0x12,0x16,0x12,0x12,0x10,  // 200
+  0xF1,0x76,0x12,0x12,0x14,0x11,0x12,0x12,0x13,0x12,0x12,0x12,0x16,0x12,0x12,0x10,  // 201
+  0xE1,0x17,0x31,0x21,0x21,0x21,0x41,0x11,0x21,0x21,0x61,0x21,0x21,0x61,0x21,0x21,  // 202
+  0xF1,0x74,0x11,0x12,0x12,0x16,0x12,0x12,0x14,0x11,0x12,0x12,0x16,0x12,0x12,0x10,  // 203
+  0xD1,0x27,0x41,  // 204
+  0x11,0xB1,0x27,  // 205
+  0x01,0xD1,0x17,  // 206
+  0x11,0xE7,0x41,  // 207
+  0x61,0x97,0x61,0x21,0x21,0x61,0x21,0x21,0x71,0x31,0x93,  // 208
+  0xE1,0x17,0x31,0x32,0x81,0x41,0x61,0x62,0x77,  // 209
+  0xF2,0x57,0x15,0x13,0x12,0x15,0x14,0x11,0x15,0x16,0x15,0x17,0x50,  // 210
+  0xF2,0x57,0x15,0x14,0x11,0x15,0x13,0x12,0x15,0x16,0x15,0x17,0x50,  // 211
+  0xF2,0x57,0x15,0x14,0x11,0x15,0x13,0x12,0x15,0x14,0x11,0x15,0x17,0x50,  // 212
+  0xF2,0x55,0x11,0x15,0x13,0x12,0x15,0x14,0x11,0x15,0x13,0x12,0x15,0x17,0x50,  // 213
+  0xF2,0x55,0x11,0x15,0x16,0x15,0x14,0x11,0x15,0x16,0x15,0x17,0x50,  // 214
+  0x41,0x31,0x91,0x11,0xA3,0xA1,0x11,0x91,0x31,  // 215
+  0xF2,0x41,0x16,0x14,0x26,0x12,0x21,0x16,0x11,0x13,0x16,0x23,0x26,0x11,0x30,  // 216
+  0xF1,0x64,0x18,0x14,0x17,0x1C,0x16,0x60,  // 217
+  0xF1,0x65,0x17,0x13,0x18,0x1C,0x16,0x60,  // 218
+  0xF1,0x65,0x17,0x13,0x18,0x14,0x17,0x16,0x60,  // 219
+  0xF1,0x65,0x17,0x1C,0x14,0x17,0x16,0x60,  // 220
+  0x31,0xD1,0xD1,0x81,0x44,0x31,0x41,0xB1,0xB1,  // 221
+  0xF1,0x77,0x13,0x18,0x13,0x18,0x13,0x19,0x30,  // 222
+  0xF2,0x66,0x14,0x17,0x12,0x12,0x17,0x21,0x11,0x1A,0x20,  // 223
+  0xF6,0x25,0x12,0x11,0x11,0x16,0x11,0x11,0x11,0x18,0x50,  // 224
+  0xF6,0x26,0x11,0x11,0x11,0x15,0x12,0x11,0x11,0x18,0x50,  // 225
+  0xF6,0x26,0x11,0x11,0x11,0x15,0x12,0x11,0x11,0x16,0x11,0x50,  // 226
+  0xF1,0x14,0x25,0x12,0x11,0x11,0x16,0x11,0x11,0x11,0x15,0x12,0x50,  // 227
+  0xF6,0x26,0x11,0x11,0x11,0x18,0x11,0x11,0x16,0x11,0x50,  // 228
+  0xF6,0x24,0x31,0x11,0x11,0x14,0x11,0x11,0x11,0x11,0x14,0x31,0x50,  // 229
+  0xF4,0x11,0x28,0x11,0x11,0x18,0x11,0x11,0x19,0x39,0x11,0x11,0x18,0x11,0x11,0x19,0x21,0x10,  // 230
+  0xF4,0x39,0x13,0x21,0x15,0x13,0x11,0x26,0x11,0x10,  // 231
+  0xF4,0x36,0x12,0x11,0x11,0x16,0x11,0x11,0x11,0x19,0x21,0x10,  // 232
+  0xF4,0x37,0x11,0x11,0x11,0x15,0x12,0x11,0x11,0x19,0x21,0x10,  // 233
+  0xF4,0x37,0x11,0x11,0x11,0x15,0x12,0x11,0x11,0x16,0x12,0x21,0x10,  // 234
+  0xF4,0x37,0x11,0x11,0x11,0x18,0x11,0x11,0x16,0x12,0x21,0x10,  // 235
+  0xF0,0x12,0x56,0x10,  // 236
+  0x31,0xB1,0x25,  // 237
+  0x31,0xB1,0x25,0x61,  // 238
+  0x31,0xE5,0x61,  // 239
+  0xF4,0x37,0x11,0x13,0x16,0x33,0x18,0x40,  // 240
+  0xF1,0x11,0x55,0x12,0x1A,0x11,0x19,0x13,0x40,  // 241
+  0xF4,0x36,0x12,0x13,0x16,0x11,0x13,0x19,0x30,  // 242
+  0xF4,0x37,0x11,0x13,0x15,0x12,0x13,0x19,0x30,  // 243
+  0xF4,0x37,0x11,0x13,0x15,0x12,0x13,0x16,0x12,0x30,  // 244
+  0xF1,0x12,0x36,0x12,0x13,0x16,0x11,0x13,0x15,0x13,0x30,  // 245
+  0xF4,0x37,0x11,0x13,0x18,0x13,0x16,0x12,0x30,  // 246
+  0x61,0xC1,0xA1,0x11,0x11,0xA1,0xC1,  // 247
+  0xF4,0x21,0x18,0x11,0x38,0x22,0x18,0x11,0x20,  // 248
+  0xF3,0x46,0x16,0x16,0x15,0x18,0x50,  // 249
+  0xF3,0x47,0x15,0x15,0x16,0x18,0x50,  // 250
+  0xF1,0x11,0x46,0x16,0x16,0x15,0x18,0x50,  // 251
+  0xF3,0x47,0x15,0x1C,0x16,0x11,0x50,  // 252
+  0x51,0xD3,0x21,0x41,0x52,0x41,0x33,0x91,  // 253
+  0xF1,0x96,0x13,0x18,0x13,0x19,0x30,  // 254
+  0x51,0xA1,0x23,0x21,0xA2,0x51,0x23,0x91,  // 255
+};
+
+constexpr char ArialMT_Plain_16_RLE[] PROGMEM = {
+  0x90, // Width: 16, run length encoded
+  0x13, // Height: 19
+  0x20, // First Char: 32
+  0xE0, // Numbers of Chars: 224
+
+  // Jump Table:
+  0xFF, 0xFF, 0x00, 0x04,  // 32:65535
+  0x00, 0x00, 0x03, 0x04,  // 33:0
+  0x00, 0x03, 0x04, 0x06,  // 34:3
+  0x00, 0x07, 0x12, 0x09,  // 35:7
+  0x00, 0x19, 0x12, 0x09,  // 36:25
+  0x00, 0x2B, 0x17, 0x0E,  // 37:43
+  0x00, 0x42, 0x18, 0x0B,  // 38:66
+  0x00, 0x5A, 0x02, 0x03,  // 39:90
+  0x00, 0x5C, 0x06, 0x05,  // 40:92
+  0x00, 0x62, 0x06, 0x05,  // 41:98
+  0x00, 0x68, 0x09, 0x06,  // 42:104
+  0x00, 0x71, 0x0B, 0x09,  // 43:113
+  0x00, 0x7C, 0x03, 0x04,  // 44:124
+  0x00, 0x7F, 0x06, 0x05,  // 45:127
+  0x00, 0x85, 0x03, 0x04,  // 46:133
+  0x00, 0x88, 0x04, 0x04,  // 47:136
+  0x00, 0x8C, 0x0D, 0x09,  // 48:140
+  0x00, 0x99, 0x07, 0x09,  // 49:153
+  0x00, 0xA0, 0x13, 0x09,  // 50:160
+  0x00, 0xB3, 0x12, 0x09,  // 51:179
+  0x00, 0xC5, 0x0F, 0x09,  // 52:197
+  0x00, 0xD4, 0x14, 0x09,  // 53:212
+  0x00, 0xE8, 0x13, 0x09,  // 54:232
+  0x00, 0xFB, 0x0D, 0x09,  // 55:251
+  0x01, 0x08, 0x16, 0x09,  // 56:264
+  0x01, 0x1E, 0x13, 0x09,  // 57:286
+  0x01, 0x31, 0x03, 0x04,  // 58:305
+  0x01, 0x34, 0x03, 0x04,  // 59:308
+  0x01, 0x37, 0x0F, 0x09,  // 60:311
+  0x01, 0x46, 0x0F, 0x09,  // 61:326
+  0x01, 0x55, 0x0F, 0x09,  // 62:341
+  0x01, 0x64, 0x0E, 0x09,  // 63:356
+  0x01, 0x72, 0x30, 0x10,  // 64:370
+  0x01, 0xA2, 0x0F, 0x0B,  // 65:418
+  0x01, 0xB1, 0x1A, 0x0B,  // 66:433
+  0x01, 0xCB, 0x14, 0x0C,  // 67:459
+  0x01, 0xDF, 0x13, 0x0C,  // 68:479
+  0x01, 0xF2, 0x19, 0x0B,  // 69:498
+  0x02, 0x0B, 0x0F, 0x0A,  // 70:523
+  0x02, 0x1A, 0x17, 0x0C,  // 71:538
+  0x02, 0x31, 0x0D, 0x0C,  // 72:561
+  0x02, 0x3E, 0x02, 0x04,  // 73:574
+  0x02, 0x40, 0x09, 0x08,  // 74:576
+  0x02, 0x49, 0x10, 0x0B,  // 75:585
+  0x02, 0x59, 0x0B, 0x09,  // 76:601
+  0x02, 0x64, 0x0F, 0x0D,  // 77:612
+  0x02, 0x73, 0x0D, 0x0C,  // 78:627
+  0x02, 0x80, 0x13, 0x0C,  // 79:640
+  0x02, 0x93, 0x11, 0x0B,  // 80:659
+  0x02, 0xA4, 0x16, 0x0C,  // 81:676
+  0x02, 0xBA, 0x14, 0x0C,  // 82:698
+  0x02, 0xCE, 0x1A, 0x0B,  // 83:718
+  0x02, 0xE8, 0x0D, 0x0A,  // 84:744
+  0x02, 0xF5, 0x0D, 0x0C,  // 85:757
+  0x03, 0x02, 0x0C, 0x0B,  // 86:770
+  0x03, 0x0E, 0x13, 0x0F,  // 87:782
+  0x03, 0x21, 0x15, 0x0B,  // 88:801
+  0x03, 0x36, 0x0D, 0x0B,  // 89:822
+  0x03, 0x43, 0x16, 0x0A,  // 90:835
+  0x03, 0x59, 0x06, 0x04,  // 91:857
+  0x03, 0x5F, 0x06, 0x04,  // 92:863
+  0x03, 0x65, 0x06, 0x04,  // 93:869
+  0x03, 0x6B, 0x0A, 0x08,  // 94:875
+  0x03, 0x75, 0x0E, 0x09,  // 95:885
+  0x03, 0x83, 0x03, 0x05,  // 96:899
+  0x03, 0x86, 0x13, 0x09,  // 97:902
+  0x03, 0x99, 0x0D, 0x09,  // 98:921
+  0x03, 0xA6, 0x0C, 0x08,  // 99:934
+  0x03, 0xB2, 0x0D, 0x09,  // 100:946
+  0x03, 0xBF, 0x13, 0x09,  // 101:959
+  0x03, 0xD2, 0x07, 0x04,  // 102:978
+  0x03, 0xD9, 0x13, 0x09,  // 103:985
+  0x03, 0xEC, 0x09, 0x09,  // 104:1004
+  0x03, 0xF5, 0x03, 0x04,  // 105:1013
+  0x03, 0xF8, 0x04, 0x04,  // 106:1016
+  0x03, 0xFC, 0x0D, 0x08,  // 107:1020
+  0x04, 0x09, 0x02, 0x04,  // 108:1033
+  0x04, 0x0B, 0x10, 0x0D,  // 109:1035
+  0x04, 0x1B, 0x09, 0x09,  // 110:1051
+  0x04, 0x24, 0x0D, 0x09,  // 111:1060
+  0x04, 0x31, 0x0D, 0x09,  // 112:1073
+  0x04, 0x3E, 0x0D, 0x09,  // 113:1086
+  0x04, 0x4B, 0x06, 0x05,  // 114:1099
+  0x04, 0x51, 0x11, 0x08,  // 115:1105
+  0x04, 0x62, 0x07, 0x04,  // 116:1122
+  0x04, 0x69, 0x09, 0x09,  // 117:1129
+  0x04, 0x72, 0x09, 0x08,  // 118:1138
+  0x04, 0x7B, 0x0E, 0x0C,  // 119:1147
+  0x04, 0x89, 0x0E, 0x08,  // 120:1161
+  0x04, 0x97, 0x0A, 0x08,  // 121:1175
+  0x04, 0xA1, 0x11, 0x08,  // 122:1185
+  0x04, 0xB2, 0x09, 0x05,  // 123:1202
+  0x04, 0xBB, 0x02, 0x04,  // 124:1211
+  0x04, 0xBD, 0x09, 0x05,  // 125:1213
+  0x04, 0xC6, 0x0C, 0x09,  // 126:1222
+  0xFF, 0xFF, 0x00, 0x00,  // 127:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 128:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 129:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 130:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 131:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 132:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 133:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 134:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 135:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 136:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 137:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 138:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 139:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 140:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 141:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 142:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 143:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 144:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 145:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 146:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 147:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 148:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 149:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 150:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 151:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 152:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 153:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 154:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 155:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 156:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 157:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 158:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 159:65535
+  0xFF, 0xFF, 0x00, 0x04,  // 160:65535
+  0x04, 0xD2, 0x03, 0x05,  // 161:1234
+  0x04, 0xD5, 0x11, 0x09,  // 162:1237
+  0x04, 0xE6, 0x13, 0x09,  // 163:1254
+  0x04, 0xF9, 0x0F, 0x09,  // 164:1273
+  0x05, 0x08, 0x18, 0x09,  // 165:1288
+  0x05, 0x20, 0x03, 0x04,  // 166:1312
+  0x05, 0x23, 0x1B, 0x09,  // 167:1315
+  0x05, 0x3E, 0x03, 0x05,  // 168:1342
+  0x05, 0x41, 0x21, 0x0C,  // 169:1345
+  0x05, 0x62, 0x0C, 0x06,  // 170:1378
+  0x05, 0x6E, 0x0C, 0x09,  // 171:1390
+  0x05, 0x7A, 0x0B, 0x09,  // 172:1402
+  0x05, 0x85, 0x06, 0x05,  // 173:1413
+  0x05, 0x8B, 0x22, 0x0C,  // 174:1419
+  0x05, 0xAD, 0x0D, 0x09,  // 175:1453
+  0x05, 0xBA, 0x08, 0x06,  // 176:1466
+  0x05, 0xC2, 0x0F, 0x09,  // 177:1474
+  0x05, 0xD1, 0x0C, 0x05,  // 178:1489
+  0x05, 0xDD, 0x0B, 0x05,  // 179:1501
+  0x05, 0xE8, 0x04, 0x05,  // 180:1512
+  0x05, 0xEC, 0x0A, 0x09,  // 181:1516
+  0x05, 0xF6, 0x0B, 0x09,  // 182:1526
+  0x06, 0x01, 0x03, 0x05,  // 183:1537
+  0x06, 0x04, 0x06, 0x05,  // 184:1540
+  0x06, 0x0A, 0x05, 0x05,  // 185:1546
+  0x06, 0x0F, 0x08, 0x06,  // 186:1551
+  0x06, 0x17, 0x0D, 0x09,  // 187:1559
+  0x06, 0x24, 0x17, 0x0D,  // 188:1572
+  0x06, 0x3B, 0x1C, 0x0D,  // 189:1595
+  0x06, 0x57, 0x1E, 0x0D,  // 190:1623
+  0x06, 0x75, 0x10, 0x0A,  // 191:1653
+  0x06, 0x85, 0x11, 0x0B,  // 192:1669
+  0x06, 0x96, 0x11, 0x0B,  // 193:1686
+  0x06, 0xA7, 0x12, 0x0B,  // 194:1703
+  0x06, 0xB9, 0x12, 0x0B,  // 195:1721
+  0x06, 0xCB, 0x11, 0x0B,  // 196:1739
+  0x06, 0xDC, 0x10, 0x0B,  // 197:1756
+  0x06, 0xEC, 0x22, 0x10,  // 198:1772
+  0x07, 0x0E, 0x17, 0x0C,  // 199:1806
+  0x07, 0x25, 0x1B, 0x0B,  // 200:1829
+  0x07, 0x40, 0x1B, 0x0B,  // 201:1856
+  0x07, 0x5B, 0x1D, 0x0B,  // 202:1883
+  0x07, 0x78, 0x1B, 0x0B,  // 203:1912
+  0x07, 0x93, 0x04, 0x04,  // 204:1939
+  0x07, 0x97, 0x04, 0x04,  // 205:1943
+  0x07, 0x9B, 0x06, 0x04,  // 206:1947
+  0x07, 0xA1, 0x04, 0x04,  // 207:1953
+  0x07, 0xA5, 0x17, 0x0C,  // 208:1957
+  0x07, 0xBC, 0x0F, 0x0C,  // 209:1980
+  0x07, 0xCB, 0x15, 0x0C,  // 210:1995
+  0x07, 0xE0, 0x15, 0x0C,  // 211:2016
+  0x07, 0xF5, 0x17, 0x0C,  // 212:2037
+  0x08, 0x0C, 0x17, 0x0C,  // 213:2060
+  0x08, 0x23, 0x15, 0x0C,  // 214:2083
+  0x08, 0x38, 0x10, 0x09,  // 215:2104
+  0x08, 0x48, 0x19, 0x0C,  // 216:2120
+  0x08, 0x61, 0x0E, 0x0C,  // 217:2145
+  0x08, 0x6F, 0x0E, 0x0C,  // 218:2159
+  0x08, 0x7D, 0x0F, 0x0C,  // 219:2173
+  0x08, 0x8C, 0x0E, 0x0C,  // 220:2188
+  0x08, 0x9A, 0x0E, 0x0B,  // 221:2202
+  0x08, 0xA8, 0x11, 0x0B,  // 222:2216
+  0x08, 0xB9, 0x0F, 0x0A,  // 223:2233
+  0x08, 0xC8, 0x15, 0x09,  // 224:2248
+  0x08, 0xDD, 0x15, 0x09,  // 225:2269
+  0x08, 0xF2, 0x17, 0x09,  // 226:2290
+  0x09, 0x09, 0x17, 0x09,  // 227:2313
+  0x09, 0x20, 0x15, 0x09,  // 228:2336
+  0x09, 0x35, 0x17, 0x09,  // 229:2357
+  0x09, 0x4C, 0x24, 0x0E,  // 230:2380
+  0x09, 0x70, 0x0F, 0x08,  // 231:2416
+  0x09, 0x7F, 0x15, 0x09,  // 232:2431
+  0x09, 0x94, 0x15, 0x09,  // 233:2452
+  0x09, 0xA9, 0x17, 0x09,  // 234:2473
+  0x09, 0xC0, 0x15, 0x09,  // 235:2496
+  0x09, 0xD5, 0x04, 0x04,  // 236:2517
+  0x09, 0xD9, 0x04, 0x04,  // 237:2521
+  0x09, 0xDD, 0x06, 0x04,  // 238:2525
+  0x09, 0xE3, 0x04, 0x04,  // 239:2531
+  0x09, 0xE7, 0x11, 0x09,  // 240:2535
+  0x09, 0xF8, 0x0C, 0x09,  // 241:2552
+  0x0A, 0x04, 0x0F, 0x09,  // 242:2564
+  0x0A, 0x13, 0x0F, 0x09,  // 243:2579
+  0x0A, 0x22, 0x11, 0x09,  // 244:2594
+  0x0A, 0x33, 0x11, 0x09,  // 245:2611
+  0x0A, 0x44, 0x0F, 0x09,  // 246:2628
+  0x0A, 0x53, 0x0D, 0x09,  // 247:2643
+  0x0A, 0x60, 0x12, 0x0A,  // 248:2656
+  0x0A, 0x72, 0x0A, 0x09,  // 249:2674
+  0x0A, 0x7C, 0x0A, 0x09,  // 250:2684
+  0x0A, 0x86, 0x0B, 0x09,  // 251:2694
+  0x0A, 0x91, 0x0A, 0x09,  // 252:2705
+  0x0A, 0x9B, 0x0C, 0x08,  // 253:2715
+  0x0A, 0xA7, 0x0D, 0x09,  // 254:2727
+  0x0A, 0xB4, 0x0C, 0x08,  // 255:2740
+
+  // Font Data:
+  0xFF,0xBA,0x11,  // 33
+  0xF7,0x4F,0xFF,0x84,  // 34
+  0x71,0x31,0xE1,0x34,0xA6,0xA3,0x11,0x31,0xE1,0x31,0xE1,0x34,0xA6,0xA3,0x11,0x31,0xE1,0x31,  // 35
+  0xF9,0x34,0x1A,0x13,0x14,0x18,0x14,0x15,0x16,0xE6,0x15,0x14,0x18,0x14,0x13,0x1A,0x14,0x30,  // 36
+  0xF8,0x4E,0x14,0x1D,0x14,0x1D,0x14,0x14,0x28,0x43,0x2F,0x02,0xE3,0xE2,0x44,0x81,0x51,0x41,0xD1,0x41,0xD1,0x41,0xE4,  // 37
+  0xFE,0x3A,0x32,0x13,0x18,0x13,0x25,0x17,0x14,0x24,0x17,0x13,0x12,0x13,0x18,0x34,0x11,0x1F,0x21,0xF2,0x11,0x1F,0x01,0x31,  // 38
+  0xF7,0x40,  // 39
+  0xFB,0x79,0x37,0x35,0x1D,0x10,  // 40
+  0xF7,0x1D,0x15,0x37,0x39,0x70,  // 41
+  0x41,0xF3,0x11,0x2E,0x3F,0x21,0x12,0xF0,0x10,  // 42
+  0xFD,0x1F,0x31,0xF3,0x1F,0x07,0xF0,0x1F,0x31,0xF3,0x10,  // 43
+  0xFF,0xF7,0x30,  // 44
+  0xB1,0xF3,0x1F,0x31,0xF3,0x10,  // 45
+  0xFF,0xF7,0x10,  // 46
+  0xD2,0xD4,0xB4,0xD2,  // 47
+  0xF9,0x8A,0x18,0x18,0x1A,0x17,0x1A,0x17,0x1A,0x18,0x18,0x1A,0x80,  // 48
+  0xFF,0xE1,0xF2,0x1F,0x21,0xF2,0xC0,  // 49
+  0xF9,0x18,0x18,0x18,0x27,0x18,0x11,0x17,0x17,0x12,0x17,0x16,0x13,0x18,0x13,0x24,0x19,0x36,0x10,  // 50
+  0xF9,0x16,0x1A,0x18,0x18,0x14,0x15,0x17,0x14,0x15,0x17,0x13,0x25,0x18,0x41,0x13,0x1F,0x03,  // 51
+  0xA2,0xF1,0x11,0x1F,0x01,0x21,0xD2,0x31,0xC1,0x51,0xB1,0x61,0xAC,0xF0,0x10,  // 52
+  0xFA,0x33,0x19,0x31,0x15,0x18,0x13,0x16,0x17,0x13,0x16,0x17,0x13,0x16,0x17,0x14,0x14,0x18,0x15,0x40,  // 53
+  0xF9,0x8A,0x13,0x14,0x18,0x13,0x16,0x17,0x13,0x16,0x17,0x13,0x16,0x18,0x13,0x14,0x1A,0x13,0x40,  // 54
+  0xF7,0x1F,0x31,0xF3,0x17,0x47,0x14,0x3B,0x12,0x2E,0x11,0x1F,0x12,  // 55
+  0xF9,0x23,0x3A,0x12,0x11,0x13,0x18,0x14,0x15,0x17,0x14,0x15,0x17,0x14,0x15,0x18,0x12,0x11,0x13,0x1A,0x23,0x30,  // 56
+  0xF9,0x43,0x1A,0x14,0x13,0x18,0x16,0x13,0x17,0x16,0x13,0x17,0x16,0x13,0x18,0x14,0x13,0x1A,0x80,  // 57
+  0xFA,0x17,0x10,  // 58
+  0xFA,0x17,0x30,  // 59
+  0xFD,0x1F,0x21,0x11,0xF1,0x11,0x1F,0x01,0x31,0xE1,0x31,0xE1,0x31,0xD1,0x51,  // 60
+  0xFB,0x13,0x1E,0x13,0x1E,0x13,0x1E,0x13,0x1E,0x13,0x1E,0x13,0x1E,0x13,0x10,  // 61
+  0xFA,0x15,0x1D,0x13,0x1E,0x13,0x1E,0x13,0x1F,0x01,0x11,0xF1,0x11,0x1F,0x21,  // 62
+  0xF9,0x2F,0x11,0xF2,0x1F,0x31,0x63,0x11,0x71,0x51,0xD1,0x31,0xF0,0x30,  // 63
+  0xFC,0x6B,0x26,0x19,0x19,0x17,0x14,0x43,0x16,0x13,0x14,0x12,0x15,0x13,0x16,0x12,0x14,0x12,0x17,0x12,0x14,0x12,0x17,0x12,0x14,0x12,0x16,0x13,0x14,0x13,0x12,0x52,0x14,0x12,0x44,0x12,0x15,0x19,0x12,0x15,0x18,0x12,0x17,0x25,0x13,0x19,0x53,0x10,  // 64
+  0xFF,0x22,0xE3,0xD4,0xC3,0x31,0xB1,0x61,0xC3,0x31,0xF0,0x4F,0x33,0xF4,0x20,  // 65
+  0xF7,0xC7,0x14,0x15,0x17,0x14,0x15,0x17,0x14,0x15,0x17,0x14,0x15,0x17,0x14,0x15,0x17,0x14,0x15,0x18,0x12,0x11,0x13,0x1A,0x23,0x30,  // 66
+  0xFA,0x6C,0x16,0x1A,0x18,0x18,0x1A,0x17,0x1A,0x17,0x1A,0x17,0x1A,0x17,0x1A,0x18,0x18,0x1A,0x16,0x10,  // 67
+  0xF7,0xC7,0x1A,0x17,0x1A,0x17,0x1A,0x17,0x1A,0x17,0x1A,0x17,0x1A,0x18,0x18,0x1A,0x16,0x1C,0x60,  // 68
+  0xF7,0xC7,0x14,0x15,0x17,0x14,0x15,0x17,0x14,0x15,0x17,0x14,0x15,0x17,0x14,0x15,0x17,0x14,0x15,0x17,0x14,0x15,0x17,0x1A,0x10,  // 69
+  0xF7,0xC7,0x15,0x1C,0x15,0x1C,0x15,0x1C,0x15,0x1C,0x15,0x1C,0x15,0x1C,0x10,  // 70
+  0xFA,0x6C,0x16,0x1A,0x18,0x18,0x1A,0x17,0x1A,0x17,0x15,0x14,0x17,0x15,0x14,0x18,0x14,0x13,0x1A,0x13,0x12,0x1F,0x03,  // 71
+  0xF7,0xCC,0x1F,0x31,0xF3,0x1F,0x31,0xF3,0x1F,0x31,0xF3,0x1D,0xC0,  // 72
+  0xF7,0xC0,  // 73
+  0xFF,0x03,0xF4,0x1F,0x31,0xF3,0x1F,0x31,0x7B,  // 74
+  0xF7,0xCE,0x1F,0x21,0xF2,0x1F,0x23,0xF0,0x13,0x1D,0x15,0x2A,0x18,0x18,0x1A,0x10,  // 75
+  0xF7,0xCF,0x31,0xF3,0x1F,0x31,0xF3,0x1F,0x31,0xF3,0x10,  // 76
+  0xF7,0xC8,0x2F,0x42,0xF4,0x2F,0x43,0xF4,0x2E,0x3E,0x2F,0x02,0xF0,0x2F,0x1C,  // 77
+  0xF7,0xC8,0x1F,0x42,0xF4,0x1F,0x42,0xF4,0x1F,0x42,0xF4,0x18,0xC0,  // 78
+  0xFA,0x6C,0x16,0x1A,0x18,0x18,0x1A,0x17,0x1A,0x17,0x1A,0x17,0x1A,0x18,0x18,0x1A,0x16,0x1C,0x60,  // 79
+  0xF7,0xC7,0x15,0x1C,0x15,0x1C,0x15,0x1C,0x15,0x1C,0x15,0x1C,0x15,0x1D,0x13,0x1F,0x03,  // 80
+  0xFA,0x6C,0x16,0x1A,0x18,0x18,0x1A,0x17,0x1A,0x17,0x18,0x11,0x17,0x18,0x11,0x18,0x18,0x1A,0x16,0x3A,0x62,0x10,  // 81
+  0xF7,0xC7,0x15,0x1C,0x15,0x1C,0x15,0x1C,0x15,0x1C,0x15,0x2B,0x15,0x11,0x2A,0x13,0x14,0x1A,0x36,0x10,  // 82
+  0xF9,0x25,0x1A,0x12,0x15,0x18,0x14,0x15,0x17,0x14,0x15,0x17,0x14,0x15,0x17,0x15,0x14,0x17,0x15,0x14,0x18,0x14,0x13,0x1A,0x14,0x30,  // 83
+  0x31,0xF3,0x1F,0x31,0xF3,0x1F,0x3C,0x71,0xF3,0x1F,0x31,0xF3,0x10,  // 84
+  0xF7,0xAF,0x41,0xF4,0x1F,0x31,0xF3,0x1F,0x31,0xF3,0x1F,0x21,0x8A,  // 85
+  0xF7,0x2F,0x43,0xF4,0x3F,0x42,0xF4,0x2F,0x02,0xE3,0xD3,0xE2,  // 86
+  0x32,0xF4,0x4F,0x44,0xF4,0x2E,0x3D,0x3D,0x3F,0x01,0xF4,0x3F,0x43,0xF4,0x3F,0x42,0xD4,0xB4,0xD2,  // 87
+  0xE1,0x71,0x91,0x91,0x71,0xB2,0x32,0xE1,0x11,0xF2,0x1F,0x21,0x11,0xE2,0x32,0xB1,0x71,0x91,0x91,0xF4,0x10,  // 88
+  0x31,0xF4,0x2F,0x41,0xF4,0x2F,0x46,0xB2,0xF1,0x1F,0x12,0xF1,0x10,  // 89
+  0xE1,0x71,0x92,0x71,0x72,0x11,0x71,0x61,0x31,0x71,0x42,0x41,0x71,0x31,0x61,0x71,0x12,0x71,0x72,0x91,0x71,0xA1,  // 90
+  0xF7,0xF0,0x41,0xD1,0x41,0xD1,  // 91
+  0x32,0xF4,0x4F,0x44,0xF4,0x20,  // 92
+  0x31,0xD1,0x41,0xD1,0x4F,0x00,  // 93
+  0x81,0xF1,0x2F,0x02,0xF1,0x1F,0x42,0xF4,0x2F,0x41,  // 94
+  0xF2,0x1F,0x31,0xF3,0x1F,0x31,0xF3,0x1F,0x31,0xF3,0x1F,0x31,0xF3,0x10,  // 95
+  0xF7,0x1F,0x41,  // 96
+  0xFC,0x12,0x3C,0x12,0x13,0x1A,0x13,0x13,0x1A,0x13,0x13,0x1A,0x12,0x14,0x1A,0x12,0x13,0x1C,0x80,  // 97
+  0xF7,0xCB,0x15,0x1B,0x17,0x1A,0x17,0x1A,0x17,0x1B,0x15,0x1D,0x50,  // 98
+  0xFC,0x5D,0x15,0x1B,0x17,0x1A,0x17,0x1A,0x17,0x1B,0x15,0x10,  // 99
+  0xFC,0x5D,0x15,0x1B,0x17,0x1A,0x17,0x1A,0x17,0x1B,0x15,0x18,0xC0,  // 100
+  0xFC,0x5D,0x12,0x12,0x1B,0x13,0x13,0x1A,0x13,0x13,0x1A,0x13,0x13,0x1B,0x12,0x12,0x1D,0x31,0x10,  // 101
+  0x61,0xF1,0xB7,0x12,0x1F,0x01,0x21,  // 102
+  0xFC,0x53,0x19,0x15,0x13,0x17,0x17,0x12,0x17,0x17,0x12,0x17,0x17,0x12,0x18,0x15,0x12,0x18,0xA0,  // 103
+  0xF7,0xCB,0x1F,0x21,0xF3,0x1F,0x31,0xF4,0x80,  // 104
+  0xF7,0x12,0x90,  // 105
+  0xF2,0x14,0x12,0xB0,  // 106
+  0xF7,0xCF,0x01,0xF2,0x1F,0x22,0xF1,0x12,0x2D,0x15,0x1B,0x17,0x10,  // 107
+  0xF7,0xC0,  // 108
+  0xFA,0x9B,0x1F,0x21,0xF3,0x1F,0x31,0xF4,0x8B,0x1F,0x21,0xF3,0x1F,0x31,0xF4,0x80,  // 109
+  0xFA,0x9B,0x1F,0x21,0xF3,0x1F,0x31,0xF4,0x80,  // 110
+  0xFC,0x5D,0x15,0x1B,0x17,0x1A,0x17,0x1A,0x17,0x1B,0x15,0x1D,0x50,  // 111
+  0xFA,0xC8,0x15,0x1B,0x17,0x1A,0x17,0x1A,0x17,0x1B,0x15,0x1D,0x50,  // 112
+  0xFC,0x5D,0x15,0x1B,0x17,0x1A,0x17,0x1A,0x17,0x1B,0x15,0x1B,0xC0,  // 113
+  0xFA,0x9B,0x1F,0x21,0xF3,0x10,  // 114
+  0xFB,0x33,0x1B,0x13,0x13,0x1A,0x13,0x13,0x1A,0x13,0x13,0x1A,0x13,0x13,0x1B,0x13,0x30,  // 115
+  0x61,0xF1,0xBA,0x17,0x1A,0x17,0x10,  // 116
+  0xFA,0x8F,0x41,0xF3,0x1F,0x31,0xF2,0x1B,0x90,  // 117
+  0x62,0xF4,0x2F,0x43,0xF4,0x2E,0x3E,0x2F,0x02,  // 118
+  0x62,0xF4,0x5F,0x42,0xE3,0xE2,0xF0,0x2F,0x42,0xF4,0x3F,0x42,0xC5,0xC2,  // 119
+  0x61,0x71,0xB1,0x51,0xD2,0x12,0xF1,0x1F,0x12,0x12,0xD1,0x51,0xB1,0x71,  // 120
+  0x63,0xF4,0x26,0x1C,0x33,0x1E,0x4D,0x3D,0x3E,0x20,  // 121
+  0x61,0x71,0xA1,0x62,0xA1,0x42,0x11,0xA1,0x31,0x31,0xA1,0x12,0x41,0xA2,0x61,0xA1,0x71,  // 122
+  0xA1,0xF3,0x1C,0x61,0x65,0x1D,0x14,0x1D,0x10,  // 123
+  0xF7,0xF0,  // 124
+  0x31,0xD1,0x41,0xD1,0x56,0x16,0xC1,0xF3,0x10,  // 125
+  0x91,0xF2,0x1F,0x31,0xF3,0x1F,0x41,0xF3,0x1F,0x31,0xF2,0x10,  // 126
+  0xFF,0xE1,0x1A,  // 161
+  0xFC,0x5D,0x15,0x12,0x27,0x15,0x49,0x12,0x32,0x1A,0x35,0x17,0x31,0x15,0x1D,0x13,0x10,  // 162
+  0x81,0x51,0x94,0x32,0x91,0x34,0x11,0x81,0x41,0x41,0x81,0x41,0x41,0x81,0xA1,0x81,0x91,0x91,0x71,  // 163
+  0xFA,0x11,0x21,0x1E,0x12,0x1E,0x14,0x1D,0x14,0x1E,0x12,0x1E,0x11,0x21,0x10,  // 164
+  0x31,0x51,0x11,0xB1,0x41,0x11,0xC2,0x21,0x11,0xE3,0x11,0xF1,0x6B,0x31,0x1C,0x22,0x11,0x1B,0x14,0x11,0x1A,0x15,0x11,0x10,  // 165
+  0xF7,0x63,0x60,  // 166
+  0x92,0x41,0x73,0x11,0x21,0x41,0x51,0x22,0x41,0x41,0x41,0x31,0x41,0x41,0x41,0x41,0x41,0x31,0x41,0x41,0x42,0x21,0x52,0x31,0x21,0x13,0xC2,  // 167
+  0x31,0xFF,0x71,  // 168
+  0x66,0xC1,0x61,0xA1,0x81,0x81,0x25,0x31,0x71,0x11,0x51,0x21,0x71,0x11,0x51,0x21,0x71,0x11,0x51,0x21,0x71,0x11,0x51,0x21,0x71,0x21,0x31,0x31,0x81,0x81,0xA1,0x61,0xC6,  // 169
+  0x41,0x12,0xE1,0x21,0x11,0xD1,0x11,0x21,0xD1,0x11,0x21,0xE5,  // 170
+  0xFE,0x1F,0x12,0x12,0xD1,0x51,0xF0,0x1F,0x12,0x12,0xD1,0x51,  // 171
+  0xFB,0x1F,0x31,0xF3,0x1F,0x31,0xF3,0x1F,0x31,0xF3,0x50,  // 172
+  0xB1,0xF3,0x1F,0x31,0xF3,0x10,  // 173
+  0x66,0xC1,0x61,0xA1,0x81,0x81,0x17,0x21,0x71,0x11,0x21,0x51,0x71,0x11,0x21,0x51,0x71,0x11,0x22,0x41,0x71,0x11,0x21,0x11,0x31,0x71,0x22,0x31,0x21,0x81,0x81,0xA1,0x61,0xC6,  // 174
+  0x21,0xF3,0x1F,0x31,0xF3,0x1F,0x31,0xF3,0x1F,0x31,0xF3,0x1F,0x31,  // 175
+  0xF8,0x2F,0x11,0x21,0xF0,0x12,0x1F,0x12,  // 176
+  0xFC,0x15,0x1C,0x15,0x1C,0x15,0x19,0x72,0x1C,0x15,0x1C,0x15,0x1C,0x15,0x10,  // 177
+  0x41,0x31,0xD1,0x32,0xD1,0x21,0x11,0xD1,0x21,0x11,0xE2,0x21,  // 178
+  0x41,0x21,0xE1,0x41,0xD1,0x41,0xD1,0x11,0x21,0xD2,0x12,  // 179
+  0xFF,0xC1,0xF2,0x10,  // 180
+  0xFA,0xCE,0x1F,0x41,0xF3,0x1F,0x31,0xF2,0x1B,0x90,  // 181
+  0x44,0xE5,0xE6,0xD6,0xDF,0x04,0x1F,0x31,0xF3,0xF0,0x41,  // 182
+  0xFF,0xF2,0x10,  // 183
+  0xFF,0x61,0xF1,0x11,0x1F,0x22,  // 184
+  0xF8,0x1F,0x21,0xF3,0x60,  // 185
+  0x44,0xE1,0x41,0xD1,0x41,0xD1,0x41,0xE4,  // 186
+  0xFF,0xF0,0x15,0x1D,0x21,0x2F,0x11,0xF0,0x15,0x1D,0x21,0x2F,0x11,  // 187
+  0xF8,0x1F,0x21,0xA1,0x76,0x41,0xF2,0x1F,0x12,0xF1,0x1F,0x12,0xF1,0x15,0x29,0x25,0x11,0x18,0x16,0x12,0x1E,0x6F,0x21,  // 188
+  0xF8,0x1F,0x21,0xA1,0x76,0x32,0xF1,0x1F,0x21,0xF1,0x2F,0x11,0xF1,0x23,0x13,0x18,0x14,0x13,0x27,0x15,0x12,0x11,0x1D,0x12,0x11,0x1E,0x22,0x10,  // 189
+  0x41,0x21,0xE1,0x41,0xD1,0x41,0x51,0x71,0x11,0x21,0x41,0x82,0x12,0x32,0xF1,0x1F,0x12,0xF1,0x1F,0x21,0x52,0x92,0x51,0x11,0x81,0x61,0x21,0xE6,0xF2,0x10,  // 190
+  0xFF,0x23,0xF0,0x13,0x1D,0x15,0x17,0x11,0x36,0x1F,0x31,0xF3,0x1F,0x21,0xF1,0x20,  // 191
+  0xFF,0x22,0xE3,0xD4,0x81,0x33,0x31,0x91,0x11,0x61,0xC3,0x31,0xF0,0x4F,0x33,0xF4,0x20,  // 192
+  0xFF,0x22,0xE3,0xD4,0xC3,0x31,0x91,0x11,0x61,0x81,0x33,0x31,0xF0,0x4F,0x33,0xF4,0x20,  // 193
+  0xFF,0x22,0xE3,0xD4,0x91,0x23,0x31,0x81,0x21,0x61,0x81,0x33,0x31,0x91,0x54,0xF3,0x3F,0x42,  // 194
+  0xFF,0x22,0xE3,0xD4,0x91,0x23,0x31,0x81,0x21,0x61,0x91,0x23,0x31,0x81,0x64,0xF3,0x3F,0x42,  // 195
+  0xFF,0x22,0xE3,0xD4,0x91,0x23,0x31,0xB1,0x61,0x91,0x23,0x31,0xF0,0x4F,0x33,0xF4,0x20,  // 196
+  0xFF,0x22,0xE3,0xD4,0x96,0x31,0x91,0x11,0x61,0x96,0x31,0xF0,0x4F,0x33,0xF4,0x20,  // 197
+  0xD2,0xF0,0x2F,0x02,0xF0,0x21,0x1D,0x23,0x1B,0x25,0x1B,0x16,0x1B,0x16,0x1B,0xC7,0x14,0x15,0x17,0x14,0x15,0x17,0x14,0x15,0x17,0x14,0x15,0x17,0x14,0x15,0x17,0x14,0x15,0x10,  // 198
+  0xFA,0x6C,0x16,0x1A,0x18,0x18,0x1A,0x17,0x1A,0x12,0x14,0x1A,0x21,0x14,0x1A,0x11,0x24,0x1A,0x18,0x18,0x1A,0x16,0x10,  // 199
+  0xF7,0xC7,0x14,0x15,0x17,0x14,0x15,0x17,0x14,0x15,0x14,0x12,0x14,0x15,0x15,0x11,0x14,0x15,0x17,0x14,0x15,0x17,0x14,0x15,0x17,0x1A,0x10,  // 200
+  0xF7,0xC7,0x14,0x15,0x17,0x14,0x15,0x17,0x14,0x15,0x15,0x11,0x14,0x15,0x14,0x12,0x14,0x15,0x17,0x14,0x15,0x17,0x14,0x15,0x17,0x1A,0x10,  // 201
+  0xF7,0xC7,0x14,0x15,0x17,0x14,0x15,0x15,0x11,0x14,0x15,0x14,0x12,0x14,0x15,0x14,0x12,0x14,0x15,0x15,0x11,0x14,0x15,0x17,0x14,0x15,0x17,0x1A,0x10,  // 202
+  0xF7,0xC7,0x14,0x15,0x17,0x14,0x15,0x15,0x11,0x14,0x15,0x17,0x14,0x15,0x15,0x11,0x14,0x15,0x17,0x14,0x15,0x17,0x14,0x15,0x17,0x1A,0x10,  // 203
+  0x01,0xF4,0x11,0xC0,  // 204
+  0xF5,0x11,0xC4,0x10,  // 205
+  0x11,0xF2,0x12,0xC4,0x1F,0x41,  // 206
+  0x11,0xF5,0xC5,0x10,  // 207
+  0x91,0xCC,0x71,0x51,0x41,0x71,0x51,0x41,0x71,0x51,0x41,0x71,0x51,0x41,0x71,0xA1,0x71,0xA1,0x81,0x81,0xA1,0x61,0xC6,  // 208
+  0xF7,0xC8,0x1F,0x42,0xD1,0x51,0xB1,0x72,0xA1,0x81,0x81,0xA2,0xF4,0x18,0xC0,  // 209
+  0xFA,0x6C,0x16,0x1A,0x18,0x18,0x1A,0x14,0x12,0x1A,0x15,0x11,0x1A,0x17,0x1A,0x18,0x18,0x1A,0x16,0x1C,0x60,  // 210
+  0xFA,0x6C,0x16,0x1A,0x18,0x18,0x1A,0x15,0x11,0x1A,0x14,0x12,0x1A,0x17,0x1A,0x18,0x18,0x1A,0x16,0x1C,0x60,  // 211
+  0xFA,0x6C,0x16,0x1A,0x18,0x16,0x11,0x1A,0x14,0x12,0x1A,0x14,0x12,0x1A,0x15,0x11,0x1A,0x18,0x18,0x1A,0x16,0x1C,0x60,  // 212
+  0xFA,0x6C,0x16,0x1A,0x18,0x16,0x11,0x1A,0x14,0x12,0x1A,0x15,0x11,0x1A,0x14,0x12,0x1A,0x18,0x18,0x1A,0x16,0x1C,0x60,  // 213
+  0xFA,0x6C,0x16,0x1A,0x18,0x18,0x1A,0x15,0x11,0x1A,0x17,0x1A,0x15,0x11,0x1A,0x18,0x18,0x1A,0x16,0x1C,0x60,  // 214
+  0xFA,0x15,0x1D,0x13,0x1F,0x01,0x11,0xF1,0x3F,0x11,0x11,0xF0,0x13,0x1D,0x15,0x10,  // 215
+  0xFA,0x62,0x19,0x16,0x29,0x17,0x28,0x16,0x22,0x17,0x15,0x14,0x17,0x14,0x15,0x17,0x12,0x26,0x18,0x27,0x19,0x26,0x19,0x12,0x60,  // 216
+  0xF7,0xAF,0x41,0xF4,0x14,0x1D,0x15,0x1C,0x1F,0x31,0xF3,0x1F,0x21,0x8A,  // 217
+  0xF7,0xAF,0x41,0xF4,0x1F,0x31,0x51,0xC1,0x41,0xD1,0xF3,0x1F,0x21,0x8A,  // 218
+  0xF7,0xAF,0x41,0xF4,0x15,0x1C,0x14,0x1D,0x14,0x1D,0x15,0x1C,0x1F,0x21,0x8A,  // 219
+  0xF7,0xAF,0x41,0xF4,0x15,0x1C,0x1F,0x31,0x51,0xC1,0xF3,0x1F,0x21,0x8A,  // 220
+  0x31,0xF4,0x2F,0x41,0xF4,0x2B,0x17,0x64,0x16,0x2F,0x11,0xF1,0x2F,0x11,  // 221
+  0xF7,0xC9,0x16,0x1B,0x16,0x1B,0x16,0x1B,0x16,0x1B,0x16,0x1B,0x16,0x1C,0x14,0x1E,0x40,  // 222
+  0xF9,0xA8,0x1F,0x21,0x91,0x81,0x33,0x41,0x83,0x21,0x41,0xE1,0x31,0xF0,0x30,  // 223
+  0xFC,0x12,0x3C,0x12,0x13,0x1A,0x13,0x13,0x17,0x12,0x13,0x13,0x18,0x11,0x12,0x14,0x1A,0x12,0x13,0x1C,0x80,  // 224
+  0xFC,0x12,0x3C,0x12,0x13,0x1A,0x13,0x13,0x18,0x11,0x13,0x13,0x17,0x12,0x12,0x14,0x1A,0x12,0x13,0x1C,0x80,  // 225
+  0xFC,0x12,0x3C,0x12,0x13,0x18,0x11,0x13,0x13,0x17,0x12,0x13,0x13,0x17,0x12,0x12,0x14,0x18,0x11,0x12,0x13,0x1C,0x80,  // 226
+  0xFC,0x12,0x3C,0x12,0x13,0x18,0x11,0x13,0x13,0x17,0x12,0x13,0x13,0x18,0x11,0x12,0x14,0x17,0x12,0x12,0x13,0x1C,0x80,  // 227
+  0xFC,0x12,0x3C,0x12,0x13,0x18,0x11,0x13,0x13,0x1A,0x13,0x13,0x18,0x11,0x12,0x14,0x1A,0x12,0x13,0x1C,0x80,  // 228
+  0xFC,0x12,0x3C,0x12,0x13,0x16,0x31,0x13,0x13,0x16,0x11,0x11,0x13,0x13,0x16,0x31,0x12,0x14,0x1A,0x12,0x13,0x1C,0x80,  // 229
+  0xFC,0x12,0x3C,0x12,0x13,0x1A,0x13,0x13,0x1A,0x13,0x13,0x1A,0x12,0x14,0x1A,0x12,0x13,0x1C,0x7C,0x12,0x12,0x1B,0x13,0x13,0x1A,0x13,0x13,0x1A,0x13,0x13,0x1B,0x12,0x12,0x1D,0x31,0x10,  // 230
+  0xFC,0x5D,0x15,0x1B,0x17,0x12,0x17,0x17,0x21,0x17,0x17,0x11,0x28,0x15,0x10,  // 231
+  0xFC,0x5D,0x12,0x12,0x18,0x12,0x13,0x13,0x18,0x11,0x13,0x13,0x1A,0x13,0x13,0x1B,0x12,0x12,0x1D,0x31,0x10,  // 232
+  0xFC,0x5D,0x12,0x12,0x1B,0x13,0x13,0x18,0x11,0x13,0x13,0x17,0x12,0x13,0x13,0x1B,0x12,0x12,0x1D,0x31,0x10,  // 233
+  0xFC,0x5D,0x12,0x12,0x19,0x11,0x13,0x13,0x17,0x12,0x13,0x13,0x17,0x12,0x13,0x13,0x18,0x12,0x12,0x12,0x1D,0x31,0x10,  // 234
+  0xFC,0x5D,0x12,0x12,0x19,0x11,0x13,0x13,0x1A,0x13,0x13,0x18,0x11,0x13,0x13,0x1B,0x12,0x12,0x1D,0x31,0x10,  // 235
+  0x31,0xF4,0x11,0x90,  // 236
+  0xF8,0x11,0x97,0x10,  // 237
+  0x41,0xF2,0x12,0x97,0x1F,0x41,  // 238
+  0x41,0xF5,0x98,0x10,  // 239
+  0xFC,0x5B,0x11,0x15,0x18,0x11,0x27,0x17,0x21,0x17,0x18,0x37,0x17,0x11,0x35,0x1D,0x50,  // 240
+  0xFA,0x98,0x12,0x1E,0x12,0x1F,0x11,0x11,0xF0,0x12,0x1F,0x48,  // 241
+  0xFC,0x5D,0x15,0x18,0x12,0x17,0x18,0x11,0x17,0x1A,0x17,0x1B,0x15,0x1D,0x50,  // 242
+  0xFC,0x5D,0x15,0x1B,0x17,0x18,0x11,0x17,0x17,0x12,0x17,0x1B,0x15,0x1D,0x50,  // 243
+  0xFC,0x5D,0x15,0x19,0x11,0x17,0x17,0x12,0x17,0x17,0x12,0x17,0x18,0x12,0x15,0x1D,0x50,  // 244
+  0xFC,0x5D,0x15,0x19,0x11,0x17,0x17,0x12,0x17,0x18,0x11,0x17,0x17,0x13,0x15,0x1D,0x50,  // 245
+  0xFC,0x5D,0x15,0x19,0x11,0x17,0x1A,0x17,0x18,0x11,0x17,0x1B,0x15,0x1D,0x50,  // 246
+  0xFD,0x1F,0x31,0xF3,0x1F,0x11,0x11,0x11,0xF1,0x1F,0x31,0xF3,0x10,  // 247
+  0xFC,0x51,0x1B,0x14,0x2B,0x14,0x12,0x1A,0x13,0x13,0x1A,0x12,0x14,0x1B,0x24,0x1B,0x11,0x50,  // 248
+  0xFA,0x8F,0x41,0x71,0xA1,0x81,0x91,0xF2,0x1B,0x90,  // 249
+  0xFA,0x8F,0x41,0xF3,0x18,0x19,0x17,0x19,0x1B,0x90,  // 250
+  0xFA,0x89,0x19,0x17,0x1A,0x17,0x1A,0x18,0x18,0x1B,0x90,  // 251
+  0xF8,0x11,0x8F,0x41,0x81,0x91,0xF3,0x1F,0x21,0xB9,  // 252
+  0x63,0xF4,0x26,0x1C,0x33,0x15,0x18,0x45,0x17,0x3D,0x3E,0x20,  // 253
+  0xF7,0xF0,0x81,0x51,0xB1,0x71,0xA1,0x71,0xA1,0x71,0xB1,0x51,0xD5,  // 254
+  0x63,0xF4,0x26,0x15,0x16,0x33,0x1E,0x46,0x16,0x3D,0x3E,0x20,  // 255
+};
+
+constexpr char ArialMT_Plain_24_RLE[] PROGMEM = {
+  0x98, // Width: 24, run length encoded
+  0x1C, // Height: 28
+  0x20, // First Char: 32
+  0xE0, // Numbers of Chars: 224
+
+  // Jump Table:
+  0xFF, 0xFF, 0x00, 0x07,  // 32:65535
+  0x00, 0x00, 0x07, 0x07,  // 33:0
+  0x00, 0x07, 0x09, 0x09,  // 34:7
+  0x00, 0x10, 0x20, 0x0D,  // 35:16
+  0x00, 0x30, 0x1E, 0x0D,  // 36:48
+  0x00, 0x4E, 0x2A, 0x15,  // 37:78
+  0x00, 0x78, 0x23, 0x10,  // 38:120
+  0x00, 0x9B, 0x04, 0x05,  // 39:155
+  0x00, 0x9F, 0x0D, 0x08,  // 40:159
+  0x00, 0xAC, 0x0D, 0x08,  // 41:172
+  0x00, 0xB9, 0x0F, 0x09,  // 42:185
+  0x00, 0xC8, 0x13, 0x0E,  // 43:200
+  0x00, 0xDB, 0x06, 0x07,  // 44:219
+  0x00, 0xE1, 0x0B, 0x08,  // 45:225
+  0x00, 0xEC, 0x05, 0x07,  // 46:236
+  0x00, 0xF1, 0x0B, 0x07,  // 47:241
+  0x00, 0xFC, 0x14, 0x0D,  // 48:252
+  0x01, 0x10, 0x0C, 0x0D,  // 49:272
+  0x01, 0x1C, 0x1D, 0x0D,  // 50:284
+  0x01, 0x39, 0x1C, 0x0D,  // 51:313
+  0x01, 0x55, 0x16, 0x0D,  // 52:341
+  0x01, 0x6B, 0x1D, 0x0D,  // 53:363
+  0x01, 0x88, 0x1D, 0x0D,  // 54:392
+  0x01, 0xA5, 0x16, 0x0D,  // 55:421
+  0x01, 0xBB, 0x1D, 0x0D,  // 56:443
+  0x01, 0xD8, 0x1D, 0x0D,  // 57:472
+  0x01, 0xF5, 0x07, 0x07,  // 58:501
+  0x01, 0xFC, 0x07, 0x07,  // 59:508
+  0x02, 0x03, 0x1A, 0x0E,  // 60:515
+  0x02, 0x1D, 0x1C, 0x0E,  // 61:541
+  0x02, 0x39, 0x1A, 0x0E,  // 62:569
+  0x02, 0x53, 0x17, 0x0D,  // 63:595
+  0x02, 0x6A, 0x44, 0x18,  // 64:618
+  0x02, 0xAE, 0x1C, 0x10,  // 65:686
+  0x02, 0xCA, 0x23, 0x10,  // 66:714
+  0x02, 0xED, 0x1F, 0x11,  // 67:749
+  0x03, 0x0C, 0x1C, 0x11,  // 68:780
+  0x03, 0x28, 0x25, 0x10,  // 69:808
+  0x03, 0x4D, 0x1D, 0x0F,  // 70:845
+  0x03, 0x6A, 0x26, 0x13,  // 71:874
+  0x03, 0x90, 0x16, 0x11,  // 72:912
+  0x03, 0xA6, 0x05, 0x07,  // 73:934
+  0x03, 0xAB, 0x0F, 0x0C,  // 74:939
+  0x03, 0xBA, 0x1C, 0x10,  // 75:954
+  0x03, 0xD6, 0x11, 0x0D,  // 76:982
+  0x03, 0xE7, 0x19, 0x14,  // 77:999
+  0x04, 0x00, 0x15, 0x11,  // 78:1024
+  0x04, 0x15, 0x21, 0x13,  // 79:1045
+  0x04, 0x36, 0x1E, 0x10,  // 80:1078
+  0x04, 0x54, 0x25, 0x13,  // 81:1108
+  0x04, 0x79, 0x22, 0x11,  // 82:1145
+  0x04, 0x9B, 0x26, 0x10,  // 83:1179
+  0x04, 0xC1, 0x15, 0x0F,  // 84:1217
+  0x04, 0xD6, 0x15, 0x11,  // 85:1238
+  0x04, 0xEB, 0x16, 0x10,  // 86:1259
+  0x05, 0x01, 0x22, 0x17,  // 87:1281
+  0x05, 0x23, 0x1D, 0x10,  // 88:1315
+  0x05, 0x40, 0x18, 0x10,  // 89:1344
+  0x05, 0x58, 0x24, 0x0F,  // 90:1368
+  0x05, 0x7C, 0x09, 0x07,  // 91:1404
+  0x05, 0x85, 0x0A, 0x07,  // 92:1413
+  0x05, 0x8F, 0x0A, 0x07,  // 93:1423
+  0x05, 0x99, 0x10, 0x0B,  // 94:1433
+  0x05, 0xA9, 0x14, 0x0D,  // 95:1449
+  0x05, 0xBD, 0x07, 0x08,  // 96:1469
+  0x05, 0xC4, 0x1F, 0x0D,  // 97:1476
+  0x05, 0xE3, 0x1A, 0x0D,  // 98:1507
+  0x05, 0xFD, 0x18, 0x0C,  // 99:1533
+  0x06, 0x15, 0x18, 0x0D,  // 100:1557
+  0x06, 0x2D, 0x21, 0x0D,  // 101:1581
+  0x06, 0x4E, 0x0D, 0x07,  // 102:1614
+  0x06, 0x5B, 0x1D, 0x0D,  // 103:1627
+  0x06, 0x78, 0x11, 0x0D,  // 104:1656
+  0x06, 0x89, 0x06, 0x05,  // 105:1673
+  0x06, 0x8F, 0x08, 0x05,  // 106:1679
+  0x06, 0x97, 0x15, 0x0C,  // 107:1687
+  0x06, 0xAC, 0x05, 0x05,  // 108:1708
+  0x06, 0xB1, 0x1A, 0x14,  // 109:1713
+  0x06, 0xCB, 0x11, 0x0D,  // 110:1739
+  0x06, 0xDC, 0x18, 0x0D,  // 111:1756
+  0x06, 0xF4, 0x19, 0x0D,  // 112:1780
+  0x07, 0x0D, 0x19, 0x0D,  // 113:1805
+  0x07, 0x26, 0x0B, 0x08,  // 114:1830
+  0x07, 0x31, 0x20, 0x0C,  // 115:1841
+  0x07, 0x51, 0x0E, 0x07,  // 116:1873
+  0x07, 0x5F, 0x11, 0x0D,  // 117:1887
+  0x07, 0x70, 0x10, 0x0C,  // 118:1904
+  0x07, 0x80, 0x19, 0x11,  // 119:1920
+  0x07, 0x99, 0x18, 0x0C,  // 120:1945
+  0x07, 0xB1, 0x12, 0x0C,  // 121:1969
+  0x07, 0xC3, 0x1D, 0x0C,  // 122:1987
+  0x07, 0xE0, 0x0D, 0x08,  // 123:2016
+  0x07, 0xED, 0x05, 0x06,  // 124:2029
+  0x07, 0xF2, 0x0D, 0x08,  // 125:2034
+  0x07, 0xFF, 0x13, 0x0E,  // 126:2047
+  0xFF, 0xFF, 0x00, 0x00,  // 127:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 128:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 129:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 130:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 131:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 132:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 133:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 134:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 135:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 136:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 137:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 138:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 139:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 140:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 141:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 142:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 143:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 144:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 145:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 146:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 147:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 148:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 149:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 150:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 151:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 152:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 153:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 154:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 155:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 156:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 157:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 158:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 159:65535
+  0xFF, 0xFF, 0x00, 0x07,  // 160:65535
+  0x08, 0x12, 0x07, 0x08,  // 161:2066
+  0x08, 0x19, 0x19, 0x0D,  // 162:2073
+  0x08, 0x32, 0x1C, 0x0D,  // 163:2098
+  0x08, 0x4E, 0x1F, 0x0D,  // 164:2126
+  0x08, 0x6D, 0x22, 0x0D,  // 165:2157
+  0x08, 0x8F, 0x06, 0x06,  // 166:2191
+  0x08, 0x95, 0x25, 0x0D,  // 167:2197
+  0x08, 0xBA, 0x09, 0x08,  // 168:2234
+  0x08, 0xC3, 0x35, 0x12,  // 169:2243
+  0x08, 0xF8, 0x10, 0x09,  // 170:2296
+  0x09, 0x08, 0x15, 0x0D,  // 171:2312
+  0x09, 0x1D, 0x11, 0x0E,  // 172:2333
+  0x09, 0x2E, 0x0B, 0x08,  // 173:2350
+  0x09, 0x39, 0x2F, 0x12,  // 174:2361
+  0x09, 0x68, 0x13, 0x0D,  // 175:2408
+  0x09, 0x7B, 0x10, 0x0A,  // 176:2427
+  0x09, 0x8B, 0x1C, 0x0D,  // 177:2443
+  0x09, 0xA7, 0x13, 0x08,  // 178:2471
+  0x09, 0xBA, 0x13, 0x08,  // 179:2490
+  0x09, 0xCD, 0x09, 0x08,  // 180:2509
+  0x09, 0xD6, 0x11, 0x0E,  // 181:2518
+  0x09, 0xE7, 0x13, 0x0D,  // 182:2535
+  0x09, 0xFA, 0x06, 0x08,  // 183:2554
+  0x0A, 0x00, 0x0A, 0x08,  // 184:2560
+  0x0A, 0x0A, 0x08, 0x08,  // 185:2570
+  0x0A, 0x12, 0x0E, 0x09,  // 186:2578
+  0x0A, 0x20, 0x17, 0x0D,  // 187:2592
+  0x0A, 0x37, 0x24, 0x14,  // 188:2615
+  0x0A, 0x5B, 0x2A, 0x14,  // 189:2651
+  0x0A, 0x85, 0x2E, 0x14,  // 190:2693
+  0x0A, 0xB3, 0x18, 0x0F,  // 191:2739
+  0x0A, 0xCB, 0x1E, 0x10,  // 192:2763
+  0x0A, 0xE9, 0x1E, 0x10,  // 193:2793
+  0x0B, 0x07, 0x1F, 0x10,  // 194:2823
+  0x0B, 0x26, 0x20, 0x10,  // 195:2854
+  0x0B, 0x46, 0x1E, 0x10,  // 196:2886
+  0x0B, 0x64, 0x1E, 0x10,  // 197:2916
+  0x0B, 0x82, 0x37, 0x18,  // 198:2946
+  0x0B, 0xB9, 0x24, 0x11,  // 199:3001
+  0x0B, 0xDD, 0x29, 0x10,  // 200:3037
+  0x0C, 0x06, 0x29, 0x10,  // 201:3078
+  0x0C, 0x2F, 0x2B, 0x10,  // 202:3119
+  0x0C, 0x5A, 0x29, 0x10,  // 203:3162
+  0x0C, 0x83, 0x08, 0x07,  // 204:3203
+  0x0C, 0x8B, 0x09, 0x07,  // 205:3211
+  0x0C, 0x94, 0x0B, 0x07,  // 206:3220
+  0x0C, 0x9F, 0x09, 0x07,  // 207:3231
+  0x0C, 0xA8, 0x22, 0x11,  // 208:3240
+  0x0C, 0xCA, 0x1C, 0x11,  // 209:3274
+  0x0C, 0xE6, 0x25, 0x13,  // 210:3302
+  0x0D, 0x0B, 0x25, 0x13,  // 211:3339
+  0x0D, 0x30, 0x27, 0x13,  // 212:3376
+  0x0D, 0x57, 0x29, 0x13,  // 213:3415
+  0x0D, 0x80, 0x25, 0x13,  // 214:3456
+  0x0D, 0xA5, 0x15, 0x0E,  // 215:3493
+  0x0D, 0xBA, 0x2A, 0x13,  // 216:3514
+  0x0D, 0xE4, 0x19, 0x11,  // 217:3556
+  0x0D, 0xFD, 0x19, 0x11,  // 218:3581
+  0x0E, 0x16, 0x1B, 0x11,  // 219:3606
+  0x0E, 0x31, 0x19, 0x11,  // 220:3633
+  0x0E, 0x4A, 0x1B, 0x10,  // 221:3658
+  0x0E, 0x65, 0x1E, 0x10,  // 222:3685
+  0x0E, 0x83, 0x1A, 0x0F,  // 223:3715
+  0x0E, 0x9D, 0x21, 0x0D,  // 224:3741
+  0x0E, 0xBE, 0x21, 0x0D,  // 225:3774
+  0x0E, 0xDF, 0x22, 0x0D,  // 226:3807
+  0x0F, 0x01, 0x23, 0x0D,  // 227:3841
+  0x0F, 0x24, 0x21, 0x0D,  // 228:3876
+  0x0F, 0x45, 0x25, 0x0D,  // 229:3909
+  0x0F, 0x6A, 0x3F, 0x15,  // 230:3946
+  0x0F, 0xA9, 0x1A, 0x0C,  // 231:4009
+  0x0F, 0xC3, 0x23, 0x0D,  // 232:4035
+  0x0F, 0xE6, 0x23, 0x0D,  // 233:4070
+  0x10, 0x09, 0x24, 0x0D,  // 234:4105
+  0x10, 0x2D, 0x23, 0x0D,  // 235:4141
+  0x10, 0x50, 0x08, 0x07,  // 236:4176
+  0x10, 0x58, 0x08, 0x07,  // 237:4184
+  0x10, 0x60, 0x0A, 0x07,  // 238:4192
+  0x10, 0x6A, 0x08, 0x07,  // 239:4202
+  0x10, 0x72, 0x1C, 0x0D,  // 240:4210
+  0x10, 0x8E, 0x18, 0x0D,  // 241:4238
+  0x10, 0xA6, 0x1A, 0x0D,  // 242:4262
+  0x10, 0xC0, 0x1A, 0x0D,  // 243:4288
+  0x10, 0xDA, 0x1B, 0x0D,  // 244:4314
+  0x10, 0xF5, 0x1C, 0x0D,  // 245:4341
+  0x11, 0x11, 0x1A, 0x0D,  // 246:4369
+  0x11, 0x2B, 0x17, 0x0D,  // 247:4395
+  0x11, 0x42, 0x1E, 0x0F,  // 248:4418
+  0x11, 0x60, 0x13, 0x0D,  // 249:4448
+  0x11, 0x73, 0x13, 0x0D,  // 250:4467
+  0x11, 0x86, 0x14, 0x0D,  // 251:4486
+  0x11, 0x9A, 0x13, 0x0D,  // 252:4506
+  0x11, 0xAD, 0x14, 0x0C,  // 253:4525
+  0x11, 0xC1, 0x17, 0x0D,  // 254:4545
+  0x11, 0xD8, 0x15, 0x0C,  // 255:4568
+
+  // Font Data:
+  0xFF,0xFF,0xFE,0xD2,0x2B,0xD2,0x20,  // 33
+  0xFF,0x36,0xF7,0x6F,0xFF,0xFF,0x36,0xF7,0x60,  // 34
+  0xA2,0x42,0xF5,0x24,0x22,0x2F,0x12,0x46,0xF1,0xAF,0x0B,0xF0,0x74,0x2F,0x02,0x32,0x42,0x22,0xF1,0x24,0x6F,0x1A,0xF0,0xBF,0x07,0x42,0xF0,0x23,0x24,0x2F,0x52,0x42,  // 35
+  0xFF,0x54,0x62,0xF0,0x65,0x4D,0x23,0x25,0x3C,0x24,0x26,0x3B,0x25,0x26,0x2A,0xF5,0x92,0x52,0x62,0xB2,0x62,0x43,0xC2,0x52,0x42,0xD3,0x57,0xF0,0x16,0x40,  // 36
+  0xFF,0x55,0xF7,0x7F,0x52,0x52,0xF4,0x17,0x1F,0x41,0x71,0x71,0xB2,0x52,0x53,0xC7,0x44,0xE5,0x35,0xF7,0x4F,0x74,0xF7,0x4F,0x74,0x35,0xE4,0x47,0xC3,0x52,0x52,0xB1,0x71,0x71,0xF4,0x17,0x1F,0x42,0x52,0xF5,0x7F,0x75,  // 37
+  0xFF,0xD4,0xF8,0x6F,0x03,0x33,0x23,0xD5,0x13,0x43,0xB3,0x24,0x62,0xB2,0x43,0x62,0xB2,0x44,0x52,0xB3,0x22,0x13,0x33,0xC6,0x33,0x12,0xE3,0x65,0xF8,0x4F,0x77,0xF6,0x23,0x3F,0xB1,  // 38
+  0xFF,0x36,0xF7,0x60,  // 39
+  0xFF,0xA8,0xF2,0xEC,0x58,0x59,0x3E,0x37,0x2F,0x32,0x61,0xF5,0x10,  // 40
+  0xFF,0x31,0xF5,0x16,0x2F,0x32,0x73,0xE3,0x95,0x85,0xCE,0xF2,0x80,  // 41
+  0xFF,0x51,0xFC,0x12,0x1F,0x95,0xF6,0x5F,0x85,0xFA,0x5F,0x81,0x21,0xF9,0x10,  // 42
+  0xFF,0xB2,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,0xF6,0xCF,0x1C,0xF6,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x20,  // 43
+  0xFF,0xFF,0xF1,0x22,0x2F,0x75,  // 44
+  0xF0,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x20,  // 45
+  0xFF,0xFF,0xF1,0x2F,0xB2,  // 46
+  0xF5,0x2F,0x85,0xF4,0x7F,0x37,0xF3,0x7F,0x45,0xF8,0x20,  // 47
+  0xFF,0x79,0xF2,0xDE,0x39,0x3C,0x3B,0x3B,0x2D,0x2B,0x2D,0x2B,0x2D,0x2B,0x3B,0x3C,0x39,0x3E,0xDF,0x29,  // 48
+  0xFF,0xFF,0xFF,0x32,0xFA,0x3F,0xA2,0xFA,0x2F,0x9F,0x2B,0xF2,  // 49
+  0xFF,0x62,0xA2,0xC4,0x93,0xC2,0xA4,0xB2,0xA2,0x12,0xB2,0x92,0x22,0xB2,0x82,0x32,0xB2,0x72,0x42,0xB2,0x62,0x52,0xC2,0x42,0x62,0xC7,0x72,0xE4,0x82,  // 50
+  0xFF,0x61,0x82,0xF0,0x38,0x3E,0x2A,0x3C,0x2D,0x2B,0x25,0x26,0x2B,0x25,0x26,0x2B,0x25,0x26,0x2C,0x23,0x36,0x2C,0x61,0x24,0x2E,0x43,0x6F,0x84,  // 51
+  0xFF,0xD3,0xF9,0x4F,0x76,0xF5,0x42,0x2F,0x43,0x42,0xF2,0x45,0x2F,0x13,0x72,0xF0,0xF2,0xBF,0x2F,0x72,0xFB,0x20,  // 52
+  0xFF,0xA2,0x32,0xF1,0x73,0x3D,0x86,0x2C,0x24,0x18,0x2B,0x23,0x28,0x2B,0x23,0x28,0x2B,0x23,0x28,0x2B,0x23,0x28,0x2B,0x24,0x25,0x3C,0x25,0x8F,0x65,  // 53
+  0xFF,0x88,0xF2,0xDE,0x43,0x23,0x3D,0x24,0x25,0x3B,0x24,0x27,0x2B,0x24,0x27,0x2B,0x24,0x27,0x2B,0x24,0x27,0x2B,0x34,0x25,0x2D,0x33,0x8F,0x02,0x55,  // 54
+  0xFF,0x32,0xFB,0x2F,0xB2,0xFB,0x2B,0x4B,0x28,0x7B,0x26,0x5F,0x02,0x44,0xF3,0x22,0x3F,0x62,0x12,0xF8,0x4F,0x92,  // 55
+  0xFF,0xD4,0xF1,0x43,0x7D,0x61,0x24,0x2C,0x33,0x36,0x2B,0x25,0x26,0x2B,0x25,0x26,0x2B,0x25,0x26,0x2B,0x33,0x36,0x2C,0x61,0x24,0x2E,0x43,0x7F,0x74,  // 56
+  0xFF,0x65,0x52,0xF0,0x83,0x3D,0x34,0x24,0x3B,0x27,0x24,0x2B,0x27,0x24,0x2B,0x27,0x24,0x2B,0x27,0x24,0x2B,0x26,0x24,0x2D,0x33,0x23,0x4E,0xDF,0x28,  // 57
+  0xFF,0xFF,0x52,0x92,0xF0,0x29,0x20,  // 58
+  0xFF,0xFF,0x52,0x92,0x22,0xB2,0x95,  // 59
+  0xFF,0xB1,0xFB,0x3F,0xA1,0x11,0xF9,0x21,0x2F,0x82,0x12,0xF7,0x23,0x2F,0x62,0x32,0xF6,0x15,0x1F,0x52,0x52,0xF4,0x25,0x2F,0x32,0x72,  // 60
+  0xFF,0x82,0x32,0xF6,0x23,0x2F,0x62,0x32,0xF6,0x23,0x2F,0x62,0x32,0xF6,0x23,0x2F,0x62,0x32,0xF6,0x23,0x2F,0x62,0x32,0xF6,0x23,0x2F,0x62,0x32,  // 61
+  0xFF,0x62,0x72,0xF3,0x25,0x2F,0x42,0x52,0xF5,0x15,0x1F,0x62,0x32,0xF6,0x23,0x2F,0x72,0x12,0xF8,0x21,0x2F,0x91,0x11,0xFA,0x3F,0xB1,  // 62
+  0xFF,0x62,0xFA,0x3F,0x93,0xF9,0x3F,0xA2,0x83,0x22,0xB2,0x74,0x22,0xB2,0x63,0xF2,0x25,0x2F,0x52,0x33,0xF5,0x7F,0x83,  // 63
+  0xFF,0xB7,0xF4,0xBF,0x04,0x74,0xC3,0xB3,0xA3,0x45,0x42,0x93,0x39,0x23,0x82,0x33,0x52,0x32,0x82,0x22,0x82,0x22,0x72,0x23,0x82,0x32,0x62,0x22,0x92,0x32,0x62,0x22,0x82,0x42,0x62,0x22,0x72,0x52,0x62,0x32,0x54,0x42,0x62,0x4B,0x32,0x63,0x18,0x32,0x32,0x72,0x13,0x82,0x32,0x73,0xA2,0x32,0x93,0x83,0x32,0xA3,0x54,0x32,0xCA,0x42,0xE6,0x52,0xFB,0x10,  // 64
+  0xF5,0x2F,0x85,0xF6,0x5F,0x56,0xF4,0x8F,0x35,0x32,0xF1,0x55,0x2F,0x12,0x82,0xF1,0x55,0x2F,0x35,0x32,0xF5,0x8F,0x86,0xFA,0x5F,0xA5,0xFB,0x20,  // 65
+  0xFF,0xFF,0x1F,0x2B,0xF2,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xC2,0x34,0x52,0xCA,0x32,0xE4,0x37,0xF7,0x40,  // 66
+  0xFF,0x87,0xF4,0xBF,0x14,0x54,0xE3,0x93,0xD2,0xB2,0xC2,0xD2,0xB2,0xD2,0xB2,0xD2,0xB2,0xD2,0xB2,0xD2,0xB2,0xD2,0xC2,0xB2,0xD3,0x93,0xE3,0x64,0xF2,0x16,0x20,  // 67
+  0xFF,0xFF,0x1F,0x2B,0xF2,0xB2,0xD2,0xB2,0xD2,0xB2,0xD2,0xB2,0xD2,0xB2,0xD2,0xB2,0xD2,0xB2,0xD2,0xB3,0xB2,0xD3,0x93,0xE3,0x73,0xF1,0xBF,0x47,  // 68
+  0xFF,0xFF,0x1F,0x2B,0xF2,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0xD2,  // 69
+  0xFF,0xFF,0x1F,0x2B,0xF2,0xB2,0x52,0xF4,0x25,0x2F,0x42,0x52,0xF4,0x25,0x2F,0x42,0x52,0xF4,0x25,0x2F,0x42,0x52,0xF4,0x25,0x2F,0x42,0x52,0xF4,0x20,  // 70
+  0xFF,0x87,0xF4,0xBF,0x14,0x54,0xE3,0x93,0xD2,0xB2,0xC3,0xB2,0xC2,0xD2,0xB2,0xD2,0xB2,0xD2,0xB2,0x62,0x52,0xB2,0x62,0x52,0xB3,0x52,0x43,0xC2,0x52,0x42,0xD3,0x42,0x42,0xE3,0x37,0xF2,0x13,0x70,  // 71
+  0xFF,0xFF,0x1F,0x2B,0xF2,0xF3,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x2F,0x4F,0x2B,0xF2,  // 72
+  0xFF,0xFF,0x1F,0x2B,0xF2,  // 73
+  0xFF,0xF0,0x3F,0xA4,0xFB,0x3F,0xB2,0xFB,0x2F,0xB2,0xFA,0x3B,0xF1,0xCF,0x00,  // 74
+  0xFF,0xFF,0x1F,0x2B,0xF2,0xF4,0x3F,0x93,0xF9,0x3F,0x95,0xF7,0x7F,0x53,0x24,0xF3,0x35,0x4F,0x03,0x74,0xD3,0x94,0xC2,0xC3,0xB1,0xE2,0xFC,0x10,  // 75
+  0xFF,0xFF,0x1F,0x2B,0xF2,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,  // 76
+  0xFF,0xFF,0x1F,0x2B,0xF2,0xB4,0xFA,0x6F,0xA7,0xFA,0x6F,0xA6,0xFB,0x2F,0x76,0xF4,0x6F,0x37,0xF3,0x6F,0x64,0xF9,0xF2,0xBF,0x20,  // 77
+  0xFF,0xFF,0x1F,0x2B,0xF2,0xC3,0xFB,0x3F,0xC3,0xFB,0x4F,0xB3,0xFB,0x4F,0xB3,0xFB,0x4F,0xB3,0xCF,0x2B,0xF2,  // 78
+  0xFF,0x87,0xF4,0xBF,0x14,0x54,0xE3,0x93,0xD2,0xB2,0xC3,0xB3,0xB2,0xD2,0xB2,0xD2,0xB2,0xD2,0xB2,0xD2,0xB2,0xD2,0xB3,0xB3,0xC2,0xB2,0xD3,0x93,0xE4,0x54,0xF1,0xBF,0x47,  // 79
+  0xFF,0xFF,0x1F,0x2B,0xF2,0xB2,0x62,0xF3,0x26,0x2F,0x32,0x62,0xF3,0x26,0x2F,0x32,0x62,0xF3,0x26,0x2F,0x32,0x62,0xF3,0x26,0x2F,0x42,0x42,0xF5,0x8F,0x74,  // 80
+  0xFF,0x87,0xF4,0xBF,0x14,0x54,0xE3,0x92,0xE2,0xB2,0xC3,0xB2,0xC2,0xD2,0xB2,0xD2,0xB2,0xD2,0xB2,0xA2,0x12,0xB2,0xA2,0x12,0xB3,0xA4,0xC2,0xA3,0xD3,0x93,0xE4,0x56,0xEB,0x13,0xF0,0x74,0x20,  // 81
+  0xFF,0xFF,0x1F,0x2B,0xF2,0xB2,0x52,0xF4,0x25,0x2F,0x42,0x52,0xF4,0x25,0x2F,0x42,0x53,0xF3,0x25,0x4F,0x22,0x56,0xF0,0x25,0x21,0x4E,0x33,0x23,0x5D,0x75,0x4D,0x58,0x2F,0xC1,  // 82
+  0xFF,0xE2,0xF3,0x35,0x4E,0x75,0x3D,0x23,0x26,0x2C,0x24,0x35,0x3B,0x25,0x26,0x2B,0x25,0x26,0x2B,0x25,0x26,0x2B,0x25,0x26,0x2B,0x25,0x35,0x2C,0x25,0x24,0x2D,0x34,0x33,0x2E,0x34,0x6F,0x12,0x54,  // 83
+  0x52,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x2F,0xBF,0x2B,0xF2,0xB2,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x20,  // 84
+  0xFF,0xFF,0x1D,0xF0,0xF0,0xFB,0x3F,0xB3,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x2F,0xA3,0xF9,0x3C,0xF0,0xDD,  // 85
+  0x51,0xFC,0x4F,0xA6,0xFA,0x5F,0xA6,0xFA,0x6F,0xA5,0xFA,0x3F,0x85,0xF5,0x6F,0x46,0xF5,0x5F,0x56,0xF6,0x4F,0x91,  // 86
+  0x52,0xFB,0x6F,0x99,0xF8,0x9F,0x87,0xFB,0x2F,0x76,0xF4,0x7F,0x37,0xF3,0x6F,0x55,0xF8,0x2F,0xB5,0xFA,0x6F,0xA7,0xF9,0x7F,0x96,0xFB,0x2F,0x67,0xF2,0x9F,0x09,0xF2,0x6F,0x72,  // 87
+  0xF6,0x1B,0x1E,0x2B,0x2B,0x4B,0x48,0x4D,0x45,0x4F,0x24,0x24,0xF4,0x8F,0x73,0xF8,0x8F,0x44,0x24,0xF1,0x46,0x3E,0x48,0x4C,0x2B,0x4B,0x1E,0x2F,0xC1,  // 88
+  0x51,0xFC,0x2F,0xC3,0xFB,0x3F,0xB3,0xFB,0x4F,0xA4,0xFB,0xAF,0x3A,0xF1,0x4F,0x84,0xF8,0x3F,0x84,0xF8,0x4F,0x92,0xFB,0x10,  // 89
+  0xF5,0x2B,0x2C,0x3B,0x2B,0x4B,0x29,0x31,0x2B,0x28,0x32,0x2B,0x27,0x33,0x2B,0x26,0x34,0x2B,0x24,0x36,0x2B,0x23,0x37,0x2B,0x22,0x38,0x2B,0x21,0x39,0x2B,0x4B,0x2B,0x3C,0x2B,0x2D,0x20,  // 90
+  0xFF,0x3F,0x76,0xF7,0x62,0xF3,0x26,0x2F,0x32,  // 91
+  0x52,0xFB,0x5F,0xA7,0xF9,0x7F,0x97,0xFA,0x5F,0xB2,  // 92
+  0xFF,0xFF,0x12,0xF3,0x26,0x2F,0x32,0x6F,0x76,0xF7,  // 93
+  0xFF,0xB1,0xFA,0x3F,0x75,0xF6,0x5F,0x73,0xFA,0x3F,0xB5,0xFA,0x5F,0xB3,0xFC,0x10,  // 94
+  0xFA,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x20,  // 95
+  0xFF,0x31,0xFC,0x2F,0xB3,0xFC,0x10,  // 96
+  0xFF,0x92,0x43,0xF3,0x33,0x5F,0x22,0x32,0x23,0xF0,0x24,0x23,0x2F,0x02,0x42,0x32,0xF0,0x23,0x24,0x2F,0x02,0x32,0x32,0xF1,0x32,0x22,0x2F,0x3B,0xF3,0xBF,0xC1,  // 97
+  0xFF,0xFF,0x1F,0x2B,0xF2,0xF2,0x25,0x2F,0x32,0x72,0xF1,0x29,0x2F,0x02,0x92,0xF0,0x29,0x2F,0x03,0x73,0xF1,0x35,0x3F,0x39,0xF6,0x50,  // 98
+  0xFF,0xA7,0xF5,0x9F,0x33,0x53,0xF1,0x37,0x3F,0x02,0x92,0xF0,0x29,0x2F,0x02,0x92,0xF0,0x37,0x3F,0x13,0x53,0xF3,0x25,0x20,  // 99
+  0xFF,0xB5,0xF6,0x9F,0x33,0x53,0xF1,0x37,0x3F,0x02,0x92,0xF0,0x29,0x2F,0x02,0x92,0xF1,0x27,0x2F,0x32,0x52,0xDF,0x2B,0xF2,  // 100
+  0xFF,0xB6,0xF5,0x9F,0x33,0x12,0x23,0xF1,0x32,0x23,0x3F,0x02,0x32,0x42,0xF0,0x23,0x24,0x2F,0x02,0x32,0x42,0xF0,0x32,0x23,0x3F,0x13,0x12,0x32,0xF3,0x52,0x2F,0x54,0x21,  // 101
+  0x92,0xFB,0x2F,0x8F,0x1B,0xF2,0xB2,0x22,0xF7,0x22,0x2F,0x72,0x22,  // 102
+  0xFF,0xB5,0x52,0xE9,0x33,0xC3,0x53,0x33,0xA3,0x73,0x32,0xA2,0x92,0x32,0xA2,0x92,0x32,0xA2,0x92,0x32,0xB2,0x72,0x33,0xC2,0x52,0x33,0xBF,0x1C,0xF0,  // 103
+  0xFF,0xFF,0x1F,0x2B,0xF2,0xF2,0x2F,0xA2,0xFA,0x2F,0xB2,0xFB,0x2F,0xB3,0xFB,0xCF,0x2B,  // 104
+  0xFF,0xFF,0x12,0x2D,0xB2,0x2D,  // 105
+  0xFA,0x2F,0xB2,0x62,0x2F,0x36,0x22,0xF2,  // 106
+  0xFF,0xFF,0x1F,0x2B,0xF2,0xF5,0x2F,0xA3,0xF9,0x5F,0x72,0x24,0xF4,0x25,0x3F,0x22,0x74,0xF0,0x1A,0x2F,0xC1,  // 107
+  0xFF,0xFF,0x1F,0x2B,0xF2,  // 108
+  0xFF,0xFF,0x5D,0xF0,0xDF,0x12,0xFB,0x1F,0xB2,0xFB,0x2F,0xB3,0xFB,0xCF,0x2B,0xF1,0x2F,0xB1,0xFB,0x2F,0xB2,0xFB,0x3F,0xBC,0xF2,0xB0,  // 109
+  0xFF,0xFF,0x5D,0xF0,0xDF,0x22,0xFA,0x2F,0xA2,0xFB,0x2F,0xB2,0xFB,0x3F,0xBC,0xF2,0xB0,  // 110
+  0xFF,0xA7,0xF5,0x9F,0x33,0x53,0xF1,0x37,0x3F,0x02,0x92,0xF0,0x29,0x2F,0x02,0x92,0xF0,0x37,0x3F,0x13,0x53,0xF3,0x9F,0x57,  // 111
+  0xFF,0xFF,0x5F,0x3A,0xF3,0xC2,0x52,0xF3,0x27,0x2F,0x12,0x92,0xF0,0x29,0x2F,0x02,0x92,0xF0,0x37,0x3F,0x13,0x53,0xF3,0x9F,0x65,  // 112
+  0xFF,0xB5,0xF6,0x9F,0x33,0x53,0xF1,0x37,0x3F,0x02,0x92,0xF0,0x29,0x2F,0x02,0x92,0xF1,0x27,0x2F,0x32,0x52,0xF2,0xF3,0xAF,0x30,  // 113
+  0xFF,0xFF,0x5D,0xF0,0xDF,0x12,0xFA,0x2F,0xB2,0xFB,0x20,  // 114
+  0xFF,0x93,0x42,0xF3,0x53,0x3F,0x13,0x13,0x33,0xF0,0x23,0x24,0x2F,0x02,0x32,0x42,0xF0,0x23,0x33,0x2F,0x02,0x33,0x32,0xF0,0x33,0x22,0x3F,0x13,0x26,0xF3,0x23,0x40,  // 115
+  0x92,0xFB,0x2F,0x8F,0x0C,0xF2,0xF0,0x29,0x2F,0x02,0x92,0xF0,0x29,0x20,  // 116
+  0xFF,0xFF,0x5B,0xF2,0xCF,0xB3,0xFB,0x2F,0xB2,0xFB,0x2F,0xA2,0xFA,0x2F,0x2D,0xF0,0xD0,  // 117
+  0x92,0xFB,0x5F,0xA5,0xFB,0x5F,0xA5,0xFB,0x3F,0x75,0xF6,0x5F,0x55,0xF6,0x5F,0x82,  // 118
+  0x93,0xFA,0x6F,0xA6,0xFA,0x6F,0xB3,0xF6,0x6F,0x55,0xF5,0x5F,0x73,0xFB,0x5F,0xB5,0xFA,0x6F,0xB3,0xF6,0x6F,0x46,0xF4,0x6F,0x73,  // 119
+  0x91,0xB1,0xF0,0x29,0x2F,0x04,0x54,0xF2,0x33,0x3F,0x57,0xF8,0x3F,0x96,0xF5,0x33,0x3F,0x33,0x54,0xF0,0x38,0x2F,0x01,0xB1,  // 120
+  0xFF,0x73,0xFA,0x6A,0x2D,0x58,0x2F,0x15,0x43,0xF3,0x9F,0x56,0xF3,0x7F,0x37,0xF4,0x5F,0x82,  // 121
+  0xFF,0xF3,0x2F,0x02,0x74,0xF0,0x26,0x5F,0x02,0x53,0x12,0xF0,0x23,0x42,0x2F,0x02,0x23,0x42,0xF0,0x21,0x35,0x2F,0x05,0x62,0xF0,0x47,0x2F,0x02,0x92,  // 122
+  0xFF,0xD2,0xFA,0x4F,0x19,0x29,0x79,0x49,0x62,0xF3,0x26,0x2F,0x32,  // 123
+  0xFF,0xFF,0x1F,0x85,0xF8,  // 124
+  0xFF,0x32,0xF3,0x26,0x2F,0x32,0x69,0x49,0x79,0x1A,0xF1,0x4F,0xA2,  // 125
+  0xFF,0xB2,0xFA,0x3F,0xA2,0xFB,0x2F,0xB2,0xFC,0x2F,0xB2,0xFC,0x2F,0xB2,0xFB,0x2F,0xA3,0xFA,0x20,  // 126
+  0xFF,0xFF,0xFF,0x32,0x2E,0xA2,0x2E,  // 161
+  0xFF,0xB6,0xF5,0x9F,0x33,0x53,0x24,0xA3,0x74,0xE2,0x56,0xF0,0x21,0x44,0x2F,0x03,0x82,0xB4,0x12,0x63,0xF2,0x34,0x3F,0x51,0x42,  // 162
+  0xD2,0x51,0xF5,0x24,0x3E,0x73,0x3D,0xF0,0xC3,0x54,0x22,0xC2,0x62,0x42,0xC2,0x62,0x42,0xC2,0x62,0x52,0xB3,0xC2,0xC3,0xB2,0xD2,0xA3,0xFB,0x10,  // 163
+  0xFF,0x71,0x81,0xF2,0x31,0x41,0x3F,0x2A,0xF4,0x24,0x2F,0x42,0x62,0xF3,0x26,0x2F,0x32,0x62,0xF3,0x26,0x2F,0x42,0x42,0xF4,0xAF,0x23,0x14,0x13,0xF2,0x18,0x10,  // 164
+  0x53,0x52,0x22,0xF0,0x34,0x22,0x2F,0x14,0x22,0x22,0xF3,0x62,0x2F,0x45,0x22,0xF6,0xAF,0x3A,0xF1,0x52,0x2F,0x36,0x22,0xF1,0x42,0x22,0x2F,0x03,0x42,0x22,0xE3,0x52,0x22,0xE1,  // 165
+  0xFF,0xFF,0x1A,0x49,0x5A,0x49,  // 166
+  0xFF,0xB3,0xF4,0x32,0x55,0x2A,0x73,0x24,0x47,0x32,0x24,0x35,0x27,0x23,0x34,0x26,0x26,0x24,0x25,0x25,0x26,0x25,0x24,0x34,0x26,0x34,0x34,0x32,0x37,0x34,0x32,0x11,0x69,0x25,0x52,0x4F,0x33,  // 167
+  0xFF,0x32,0xFB,0x2F,0xFF,0xFF,0x72,0xFB,0x20,  // 168
+  0xB5,0xF6,0x9F,0x33,0x53,0xF1,0x29,0x2E,0x32,0x43,0x3D,0x21,0x82,0x2C,0x22,0x24,0x23,0x2B,0x21,0x26,0x22,0x2B,0x21,0x26,0x22,0x2B,0x21,0x26,0x22,0x2B,0x21,0x26,0x22,0x2B,0x21,0x34,0x32,0x2C,0x21,0x24,0x22,0x2D,0x31,0x14,0x12,0x3E,0x29,0x2F,0x13,0x53,0xF3,0x9F,0x65,  // 169
+  0xFF,0x42,0x23,0xF5,0x31,0x5F,0x42,0x21,0x22,0xF4,0x22,0x12,0x2F,0x49,0xF5,0x80,  // 170
+  0xFF,0xD1,0xFA,0x5F,0x64,0x14,0xF3,0x35,0x3F,0x21,0x41,0x41,0xF5,0x5F,0x64,0x14,0xF3,0x35,0x3F,0x21,0x91,  // 171
+  0xFF,0x82,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x7F,0x67,  // 172
+  0xF0,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x20,  // 173
+  0xB5,0xF6,0x9F,0x33,0x53,0xF1,0x29,0x2E,0x39,0x3D,0x21,0x91,0x2C,0x22,0x92,0x2B,0x22,0x22,0x25,0x2B,0x22,0x22,0x25,0x2B,0x22,0x22,0x34,0x2B,0x22,0x83,0x2B,0x23,0x42,0x22,0x2C,0x29,0x11,0x2D,0x39,0x3E,0x29,0x2F,0x13,0x53,0xF3,0x9F,0x65,  // 174
+  0x22,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,  // 175
+  0xFF,0x53,0xF9,0x13,0x1F,0x71,0x51,0xF6,0x15,0x1F,0x61,0x51,0xF7,0x13,0x1F,0x93,  // 176
+  0xFF,0xB2,0x52,0xF4,0x25,0x2F,0x42,0x52,0xF4,0x25,0x2F,0x42,0x52,0xEE,0xEE,0xF4,0x25,0x2F,0x42,0x52,0xF4,0x25,0x2F,0x42,0x52,0xF4,0x25,0x20,  // 177
+  0x61,0x61,0xF4,0x25,0x2F,0x41,0x53,0xF4,0x14,0x21,0x1F,0x41,0x32,0x21,0xF4,0x53,0x1F,0x53,0x41,  // 178
+  0x61,0x51,0xF5,0x25,0x2F,0x41,0x71,0xF4,0x13,0x13,0x1F,0x41,0x31,0x31,0xF4,0x41,0x4F,0x53,0x13,  // 179
+  0xFF,0xFF,0xFF,0x11,0xFA,0x3F,0xA2,0xFB,0x10,  // 180
+  0xFF,0xFF,0x5F,0x3A,0xF3,0xF4,0x3F,0xC2,0xFB,0x2F,0xB2,0xFB,0x2F,0x93,0xF1,0xDF,0x0D,  // 181
+  0x84,0xF7,0x8F,0x58,0xF4,0xAF,0x3A,0xF3,0xF7,0x6F,0x76,0x2F,0xB2,0xFB,0xF7,0x6F,0x76,0x2F,0xB2,  // 182
+  0xFF,0xFF,0xFF,0x72,0xFB,0x20,  // 183
+  0xFF,0xF8,0x1F,0xC1,0xF9,0x21,0x1F,0xA3,0xFB,0x10,  // 184
+  0xFF,0x52,0xFA,0x2F,0xB2,0xFA,0x9F,0x49,  // 185
+  0xFF,0x55,0xF7,0x7F,0x53,0x33,0xF4,0x25,0x2F,0x43,0x33,0xF5,0x7F,0x75,  // 186
+  0xFF,0xFF,0xFF,0x41,0x91,0xF2,0x35,0x3F,0x34,0x14,0xF6,0x5F,0x51,0x41,0x41,0xF2,0x35,0x3F,0x34,0x14,0xF6,0x5F,0xA1,  // 187
+  0xFF,0x52,0xFA,0x2F,0xB2,0xD1,0xB9,0x53,0xB9,0x43,0xF9,0x3F,0x83,0xF9,0x3F,0x93,0xF8,0x3F,0x93,0xF9,0x3F,0x93,0x72,0xE3,0x83,0xD3,0x73,0x11,0xD2,0x72,0x31,0xF6,0x9F,0x49,0xFA,0x10,  // 188
+  0xFF,0x52,0xFA,0x2F,0xB2,0xD1,0xB9,0x62,0xB9,0x43,0xF9,0x3F,0x93,0xF8,0x3F,0x93,0xF9,0x3F,0x83,0xF9,0x32,0x16,0x1E,0x32,0x25,0x2C,0x34,0x15,0x3B,0x35,0x14,0x21,0x1B,0x26,0x13,0x22,0x1F,0x46,0x21,0xF5,0x34,0x10,  // 189
+  0x61,0x51,0xF5,0x25,0x2F,0x41,0x71,0xF4,0x13,0x13,0x17,0x1B,0x13,0x13,0x16,0x2B,0x41,0x45,0x3C,0x31,0x34,0x3F,0x93,0xF9,0x3F,0x83,0xF9,0x3F,0x93,0xF8,0x36,0x2F,0x13,0x63,0xF0,0x35,0x31,0x1D,0x36,0x23,0x1D,0x26,0x9B,0x17,0x9F,0xA1,  // 190
+  0xFF,0xFF,0xF1,0x4F,0x87,0xF4,0x43,0x2F,0x33,0x53,0xA2,0x25,0x72,0xA2,0x24,0x82,0xFB,0x2F,0xA3,0xF9,0x3F,0x93,0xFA,0x20,  // 191
+  0xF5,0x2F,0x85,0xF6,0x5F,0x56,0xF4,0x8C,0x15,0x53,0x2C,0x22,0x55,0x2C,0x31,0x28,0x2E,0x11,0x55,0x2F,0x35,0x32,0xF5,0x8F,0x86,0xFA,0x5F,0xA5,0xFB,0x20,  // 192
+  0xF5,0x2F,0x85,0xF6,0x5F,0x56,0xF4,0x8F,0x35,0x32,0xE1,0x15,0x52,0xC3,0x12,0x82,0xC2,0x25,0x52,0xC1,0x55,0x32,0xF5,0x8F,0x86,0xFA,0x5F,0xA5,0xFB,0x20,  // 193
+  0xF5,0x2F,0x85,0xF6,0x5F,0x56,0xF4,0x8E,0x13,0x53,0x2D,0x21,0x55,0x2C,0x22,0x28,0x2C,0x22,0x55,0x2D,0x23,0x53,0x2E,0x15,0x8F,0x86,0xFA,0x5F,0xA5,0xFB,0x20,  // 194
+  0xF5,0x2F,0x85,0xF6,0x5F,0x56,0xC2,0x58,0xC3,0x35,0x32,0xC2,0x25,0x52,0xC2,0x22,0x82,0xD2,0x15,0x52,0xD2,0x35,0x32,0xC3,0x58,0xC2,0x96,0xFA,0x5F,0xA5,0xFB,0x20,  // 195
+  0xF5,0x2F,0x85,0xF6,0x5F,0x56,0xF4,0x8D,0x23,0x53,0x2D,0x21,0x55,0x2F,0x12,0x82,0xF1,0x55,0x2D,0x23,0x53,0x2D,0x25,0x8F,0x86,0xFA,0x5F,0xA5,0xFB,0x20,  // 196
+  0xF5,0x2F,0x85,0xF6,0x5F,0x56,0xF4,0x8D,0x32,0x53,0x2C,0x13,0x55,0x2C,0x13,0x28,0x2C,0x13,0x55,0x2D,0x32,0x53,0x2F,0x58,0xF8,0x6F,0xA5,0xFA,0x5F,0xB2,  // 197
+  0xF5,0x2F,0x94,0xF7,0x4F,0x74,0xF7,0x5F,0x64,0x12,0xF4,0x43,0x2F,0x24,0x52,0xF1,0x37,0x2F,0x12,0x82,0xF1,0x28,0x2F,0x1F,0x2B,0xF2,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0xD2,  // 198
+  0xFF,0x87,0xF4,0xBF,0x14,0x54,0xE3,0x93,0xD2,0xB2,0xC2,0xD2,0x31,0x72,0xD2,0x31,0x72,0xD4,0x11,0x72,0xD2,0x13,0x72,0xD2,0x21,0x82,0xD2,0xC2,0xB2,0xD3,0x93,0xE3,0x64,0xF2,0x16,0x20,  // 199
+  0xFF,0xFF,0x1F,0x2B,0xF2,0xB2,0x52,0x62,0xB2,0x52,0x62,0x71,0x32,0x52,0x62,0x72,0x22,0x52,0x62,0x73,0x12,0x52,0x62,0x91,0x12,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0xD2,  // 200
+  0xFF,0xFF,0x1F,0x2B,0xF2,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0x91,0x12,0x52,0x62,0x73,0x12,0x52,0x62,0x72,0x22,0x52,0x62,0x71,0x32,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0xD2,  // 201
+  0xFF,0xFF,0x1F,0x2B,0xF2,0xB2,0x52,0x62,0xB2,0x52,0x62,0x91,0x12,0x52,0x62,0x82,0x12,0x52,0x62,0x72,0x22,0x52,0x62,0x72,0x22,0x52,0x62,0x82,0x12,0x52,0x62,0x91,0x12,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0xD2,  // 202
+  0xFF,0xFF,0x1F,0x2B,0xF2,0xB2,0x52,0x62,0xB2,0x52,0x62,0x82,0x12,0x52,0x62,0x82,0x12,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0x82,0x12,0x52,0x62,0x82,0x12,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0xD2,  // 203
+  0xFE,0x1F,0xC2,0x2F,0x27,0x31,0xF2,0x91,  // 204
+  0xFF,0x11,0xFA,0x31,0xF2,0x72,0x2F,0x27,0x10,  // 205
+  0x31,0xFB,0x2F,0xA2,0x2F,0x27,0x22,0xF2,0x82,0xFC,0x10,  // 206
+  0x22,0xFB,0x2F,0xEF,0x2B,0xF2,0x82,0xFB,0x20,  // 207
+  0xC2,0xFB,0x2F,0x4F,0x2B,0xF2,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0x52,0x62,0xB2,0xD2,0xB2,0xD2,0xB3,0xB2,0xD3,0x93,0xE3,0x73,0xF1,0xBF,0x47,  // 208
+  0xFF,0xFF,0x1F,0x2B,0xF2,0xC3,0xF6,0x23,0x3F,0x43,0x53,0xF2,0x27,0x4F,0x02,0x93,0xF0,0x29,0x4D,0x2B,0x3B,0x3C,0x49,0x2F,0x03,0xCF,0x2B,0xF2,  // 209
+  0xFF,0x87,0xF4,0xBF,0x14,0x54,0xE3,0x93,0xD2,0xB2,0xC3,0xB3,0x71,0x32,0xD2,0x72,0x22,0xD2,0x73,0x12,0xD2,0x91,0x12,0xD2,0xB2,0xD2,0xB3,0xB3,0xC2,0xB2,0xD3,0x93,0xE4,0x54,0xF1,0xBF,0x47,  // 210
+  0xFF,0x87,0xF4,0xBF,0x14,0x54,0xE3,0x93,0xD2,0xB2,0xC3,0xB3,0xB2,0xD2,0x91,0x12,0xD2,0x73,0x12,0xD2,0x72,0x22,0xD2,0x71,0x32,0xD2,0xB3,0xB3,0xC2,0xB2,0xD3,0x93,0xE4,0x54,0xF1,0xBF,0x47,  // 211
+  0xFF,0x87,0xF4,0xBF,0x14,0x54,0xE3,0x93,0xD2,0xB2,0xC3,0xB3,0x91,0x12,0xD2,0x82,0x12,0xD2,0x72,0x22,0xD2,0x72,0x22,0xD2,0x82,0x12,0xD2,0x91,0x13,0xB3,0xC2,0xB2,0xD3,0x93,0xE4,0x54,0xF1,0xBF,0x47,  // 212
+  0xFF,0x87,0xF4,0xBF,0x14,0x54,0xE3,0x93,0x92,0x22,0xB2,0x83,0x13,0xB3,0x72,0x22,0xD2,0x72,0x22,0xD2,0x82,0x12,0xD2,0x82,0x12,0xD2,0x73,0x12,0xD2,0x72,0x23,0xB3,0xC2,0xB2,0xD3,0x93,0xE4,0x54,0xF1,0xBF,0x47,  // 213
+  0xFF,0x87,0xF4,0xBF,0x14,0x54,0xE3,0x93,0xD2,0xB2,0xC3,0xB3,0x82,0x12,0xD2,0x82,0x12,0xD2,0xB2,0xD2,0xB2,0xD2,0x82,0x12,0xD2,0x82,0x13,0xB3,0xC2,0xB2,0xD3,0x93,0xE4,0x54,0xF1,0xBF,0x47,  // 214
+  0xFF,0xFF,0x52,0x52,0xF4,0x33,0x3F,0x53,0x13,0xF7,0x5F,0x93,0xF9,0x5F,0x73,0x13,0xF5,0x33,0x3F,0x42,0x52,  // 215
+  0xFF,0x87,0x41,0xEB,0x13,0xC4,0x56,0xC3,0x84,0xD2,0x85,0xC3,0x73,0x13,0xB2,0x73,0x32,0xB2,0x63,0x42,0xB2,0x53,0x52,0xB2,0x43,0x62,0xB2,0x33,0x72,0xB3,0x13,0x73,0xC5,0x82,0xD4,0x83,0xC6,0x54,0xC3,0x1B,0xE1,0x47,  // 216
+  0xFF,0xFF,0x1D,0xF0,0xF0,0xFB,0x3F,0xB3,0x71,0xF3,0x27,0x2F,0x22,0x73,0xF1,0x29,0x1F,0x12,0xFB,0x2F,0xA3,0xF9,0x3C,0xF0,0xDD,  // 217
+  0xFF,0xFF,0x1D,0xF0,0xF0,0xFB,0x3F,0xB3,0xFB,0x29,0x1F,0x12,0x73,0xF1,0x27,0x2F,0x22,0x71,0xF3,0x2F,0xA3,0xF9,0x3C,0xF0,0xDD,  // 218
+  0xFF,0xFF,0x1D,0xF0,0xF0,0xFB,0x3F,0xB3,0x91,0xF1,0x28,0x2F,0x12,0x72,0xF2,0x27,0x2F,0x22,0x82,0xF1,0x29,0x1F,0x03,0xF9,0x3C,0xF0,0xDD,  // 219
+  0xFF,0xFF,0x1D,0xF0,0xF0,0xFB,0x3F,0xB3,0x82,0xF1,0x28,0x2F,0x12,0xFB,0x2F,0xB2,0x82,0xF1,0x28,0x2F,0x03,0xF9,0x3C,0xF0,0xDD,  // 220
+  0x51,0xFC,0x2F,0xC3,0xFB,0x3F,0xB3,0xFB,0x4F,0xA4,0xF2,0x18,0xA7,0x38,0xA7,0x27,0x4F,0x01,0x74,0xF8,0x3F,0x84,0xF8,0x4F,0x92,0xFB,0x10,  // 221
+  0xFF,0xFF,0x1F,0x2B,0xF2,0xE2,0x72,0xF2,0x27,0x2F,0x22,0x72,0xF2,0x27,0x2F,0x22,0x72,0xF2,0x27,0x2F,0x22,0x72,0xF2,0x26,0x3F,0x32,0x43,0xF4,0x8F,0x75,  // 222
+  0xFF,0xFF,0x3F,0x0C,0xF1,0xC2,0xFA,0x2C,0x1D,0x2B,0x3C,0x2C,0x3B,0x33,0x45,0x2C,0x95,0x2D,0x43,0x24,0x2F,0x62,0x23,0xF6,0x6F,0x84,  // 223
+  0xFF,0x92,0x43,0xF3,0x33,0x5F,0x22,0x32,0x23,0xB1,0x32,0x42,0x32,0xB2,0x22,0x42,0x32,0xB3,0x12,0x32,0x42,0xD1,0x12,0x32,0x32,0xF1,0x32,0x22,0x2F,0x3B,0xF3,0xBF,0xC1,  // 224
+  0xFF,0x92,0x43,0xF3,0x33,0x5F,0x22,0x32,0x23,0xF0,0x24,0x23,0x2D,0x11,0x24,0x23,0x2B,0x31,0x23,0x24,0x2B,0x22,0x23,0x23,0x2C,0x13,0x32,0x22,0x2F,0x3B,0xF3,0xBF,0xC1,  // 225
+  0xFF,0x92,0x43,0xF3,0x33,0x5E,0x12,0x23,0x22,0x3C,0x21,0x24,0x23,0x2B,0x22,0x24,0x23,0x2B,0x22,0x23,0x24,0x2C,0x21,0x23,0x23,0x2E,0x11,0x32,0x22,0x2F,0x3B,0xF3,0xBF,0xC1,  // 226
+  0xFF,0x92,0x43,0xE2,0x23,0x35,0xC3,0x22,0x32,0x23,0xB2,0x22,0x42,0x32,0xB2,0x22,0x42,0x32,0xC2,0x12,0x32,0x42,0xC2,0x12,0x32,0x32,0xC3,0x13,0x22,0x22,0xD2,0x3B,0xF3,0xBF,0xC1,  // 227
+  0xFF,0x92,0x43,0xF3,0x33,0x5D,0x22,0x23,0x22,0x3C,0x21,0x24,0x23,0x2F,0x02,0x42,0x32,0xF0,0x23,0x24,0x2C,0x21,0x23,0x23,0x2D,0x21,0x32,0x22,0x2F,0x3B,0xF3,0xBF,0xC1,  // 228
+  0xFF,0x92,0x43,0xF3,0x33,0x5F,0x22,0x32,0x23,0xA3,0x22,0x42,0x32,0x91,0x31,0x12,0x42,0x32,0x91,0x31,0x12,0x32,0x42,0x91,0x31,0x12,0x32,0x32,0xB3,0x23,0x22,0x22,0xF3,0xBF,0x3B,0xFC,0x10,  // 229
+  0xFF,0xA1,0x34,0xF3,0x32,0x6F,0x22,0x23,0x23,0xF0,0x23,0x24,0x2F,0x02,0x32,0x42,0xF0,0x23,0x24,0x2F,0x02,0x32,0x42,0xF0,0x22,0x24,0x2F,0x13,0x12,0x33,0xF2,0xAF,0x3B,0xF2,0x22,0x22,0x3F,0x13,0x22,0x33,0xF0,0x23,0x24,0x2F,0x02,0x32,0x42,0xF0,0x23,0x24,0x2F,0x02,0x32,0x42,0xF1,0x22,0x23,0x2F,0x35,0x22,0xF6,0x32,0x10,  // 230
+  0xFF,0xA7,0xF5,0x9F,0x33,0x53,0xF1,0x37,0x33,0x1B,0x29,0x23,0x1B,0x29,0x41,0x1B,0x29,0x21,0x3B,0x37,0x32,0x1D,0x35,0x3F,0x32,0x52,  // 231
+  0xFF,0xB6,0xF5,0x9F,0x33,0x12,0x23,0xC1,0x33,0x22,0x33,0xB2,0x22,0x32,0x42,0xB3,0x12,0x32,0x42,0xD1,0x12,0x32,0x42,0xF0,0x32,0x23,0x3F,0x13,0x12,0x32,0xF3,0x52,0x2F,0x54,0x21,  // 232
+  0xFF,0xB6,0xF5,0x9F,0x33,0x12,0x23,0xF1,0x32,0x23,0x3D,0x11,0x23,0x24,0x2B,0x31,0x23,0x24,0x2B,0x22,0x23,0x24,0x2B,0x13,0x32,0x23,0x3F,0x13,0x12,0x32,0xF3,0x52,0x2F,0x54,0x21,  // 233
+  0xFF,0xB6,0xF5,0x9F,0x33,0x12,0x23,0xE1,0x13,0x22,0x33,0xC2,0x12,0x32,0x42,0xB2,0x22,0x32,0x42,0xB2,0x22,0x32,0x42,0xC2,0x13,0x22,0x33,0xD1,0x23,0x12,0x32,0xF3,0x52,0x2F,0x54,0x21,  // 234
+  0xFF,0xB6,0xF5,0x9F,0x33,0x12,0x23,0xD2,0x13,0x22,0x33,0xC2,0x12,0x32,0x42,0xF0,0x23,0x24,0x2F,0x02,0x32,0x42,0xC2,0x13,0x22,0x33,0xC2,0x23,0x12,0x32,0xF3,0x52,0x2F,0x54,0x21,  // 235
+  0xFF,0x31,0xFC,0x22,0xDB,0x31,0xDD,0x10,  // 236
+  0xFF,0x51,0xFA,0x31,0xDB,0x22,0xDB,0x10,  // 237
+  0x71,0xFB,0x2F,0xA2,0x2D,0xB2,0x2D,0xC2,0xFC,0x10,  // 238
+  0x62,0xFB,0x2F,0xED,0xF0,0xDC,0x2F,0xB2,  // 239
+  0xFF,0xA7,0xF5,0x9F,0x11,0x13,0x53,0xC1,0x15,0x73,0xB1,0x11,0x12,0x92,0xB3,0x12,0x92,0xC2,0x12,0x92,0xC6,0x73,0xB1,0x25,0x53,0xF2,0xAF,0x66,  // 240
+  0xFF,0xFF,0x5D,0xC2,0x1D,0xB3,0x32,0xF5,0x23,0x2F,0x62,0x22,0xF8,0x21,0x2F,0x82,0x12,0xF7,0x31,0x3F,0x62,0x3C,0xF2,0xB0,  // 241
+  0xFF,0xA7,0xF5,0x9F,0x33,0x53,0xC1,0x33,0x73,0xB2,0x22,0x92,0xB3,0x12,0x92,0xD1,0x12,0x92,0xF0,0x37,0x3F,0x13,0x53,0xF3,0x9F,0x57,  // 242
+  0xFF,0xA7,0xF5,0x9F,0x33,0x53,0xF1,0x37,0x3D,0x11,0x29,0x2B,0x31,0x29,0x2B,0x22,0x29,0x2B,0x13,0x37,0x3F,0x13,0x53,0xF3,0x9F,0x57,  // 243
+  0xFF,0xA7,0xF5,0x9F,0x33,0x53,0xE1,0x13,0x73,0xC2,0x12,0x92,0xB2,0x22,0x92,0xB2,0x22,0x92,0xC2,0x13,0x73,0xD1,0x23,0x53,0xF3,0x9F,0x57,  // 244
+  0xFF,0xA7,0xF5,0x9E,0x22,0x35,0x3C,0x31,0x37,0x3B,0x22,0x29,0x2B,0x22,0x29,0x2C,0x21,0x29,0x2C,0x21,0x37,0x3B,0x32,0x35,0x3C,0x24,0x9F,0x57,  // 245
+  0xFF,0xA7,0xF5,0x9F,0x33,0x53,0xD2,0x13,0x73,0xC2,0x12,0x92,0xF0,0x29,0x2F,0x02,0x92,0xC2,0x13,0x73,0xC2,0x23,0x53,0xF3,0x9F,0x57,  // 246
+  0xFF,0xA2,0xFB,0x2F,0xB2,0xFB,0x2F,0xB2,0xF8,0x21,0x21,0x2F,0x52,0x12,0x12,0xF8,0x2F,0xB2,0xFB,0x2F,0xB2,0xFB,0x20,  // 247
+  0xFF,0xFF,0x87,0x22,0xF1,0xCF,0x03,0x53,0xF1,0x34,0x6F,0x02,0x43,0x22,0xF0,0x22,0x43,0x2F,0x02,0x13,0x52,0xF0,0x55,0x3F,0x13,0x53,0xF0,0xCF,0x12,0x27,  // 248
+  0xFF,0xFF,0x5B,0xF2,0xCC,0x1D,0x3B,0x2D,0x2B,0x3C,0x2D,0x1C,0x2F,0xA2,0xFA,0x2F,0x2D,0xF0,0xD0,  // 249
+  0xFF,0xFF,0x5B,0xF2,0xCF,0xB3,0xFB,0x2D,0x1C,0x2B,0x3C,0x2B,0x2C,0x2C,0x1C,0x2F,0x2D,0xF0,0xD0,  // 250
+  0xFF,0xFF,0x5B,0xF2,0xCE,0x1B,0x3C,0x2C,0x2B,0x2D,0x2B,0x2D,0x2C,0x2B,0x2E,0x1A,0x2F,0x2D,0xF0,0xD0,  // 251
+  0xFF,0xFF,0x5B,0xF2,0xCD,0x2B,0x3C,0x2C,0x2F,0xB2,0xFB,0x2C,0x2B,0x2D,0x2A,0x2F,0x2D,0xF0,0xD0,  // 252
+  0xFF,0x73,0xFA,0x6A,0x2D,0x58,0x2F,0x15,0x43,0x81,0x99,0x73,0xA6,0x92,0x77,0xC1,0x57,0xF4,0x5F,0x82,  // 253
+  0xFF,0xFF,0x1F,0x76,0xF7,0xB3,0x62,0xF1,0x29,0x2F,0x02,0x92,0xF0,0x29,0x2F,0x03,0x73,0xF1,0x35,0x3F,0x39,0xF5,0x60,  // 254
+  0xFF,0x73,0xFA,0x6A,0x27,0x24,0x58,0x27,0x27,0x54,0x3F,0x39,0xF5,0x6A,0x26,0x7D,0x23,0x7F,0x45,0xF8,0x20,  // 255
+};
+
+#endif
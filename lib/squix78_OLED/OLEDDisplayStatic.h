@@ -0,0 +1,138 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2016 by Daniel Eichhorn
+ * Copyright (c) 2016 by Fabrice Weinberg
+ * Copyright (c) 2017 by Mark Cooke
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// A display with its size fixed at compile time and its buffers inside the
+// object, one type change for existing code:
+//
+//   SSD1306Spi display(OLED_RST, OLED_DC, OLED_CS);
+//   OLEDDisplayStatic<SSD1306Spi, 64, 32> display(OLED_RST, OLED_DC, OLED_CS);
+//
+// init() doesn't malloc() anything, a global display ends up in .bss where
+// the linker accounts for it. setScreenSize() is ignored. The pixel, line,
+// rectangle and circle functions called on the display itself clip against
+// W and H as immediates and step pages with a constant stride. Called
+// through an OLEDDisplay pointer or reference (OLEDDisplayUi) they read the
+// size at run time like on any other display, with the same result. Include
+// this after the display header.
+
+#ifndef OLEDDISPLAYSTATIC_h
+#define OLEDDISPLAYSTATIC_h
+
+#ifndef OLEDDISPLAY_h
+#error "include OLEDDisplayStatic.h after the display header"
+#endif
+
+#ifdef OLEDDISPLAY_DISPLAY_LIST
+#error "OLEDDISPLAY_DISPLAY_LIST draws without a framebuffer, use the display class itself"
+#endif
+
+template <class Display, uint8_t W, uint8_t H>
+class OLEDDisplayStatic : public Display
+{
+   static_assert(W > 0 && W <= 128, "the controllers have at most 128 columns");
+   static_assert(H > 0 && H <= 8 * OLEDDISPLAY_MAX_PAGES && H % 8 == 0,
+                 "the height is a whole number of pages");
+
+  public:
+   typedef OLEDFixedScreen<W, H> Screen;
+
+   // Takes the arguments of the Display constructor
+   template <typename... Args>
+   OLEDDisplayStatic(Args... args) : Display(args...)
+   {
+      Display::setScreenSize(W, H);
+      this->staticBuffers = true;
+      this->buffer        = frame;
+#ifdef OLEDDISPLAY_DOUBLE_BUFFER
+      this->buffer_back = backFrame;
+#endif
+#ifdef OLEDDISPLAY_PAGE_HASH
+      this->page_hashes = pageHashes;
+#endif
+   }
+
+   void setScreenSize(uint8_t = W, uint8_t = H) {}
+
+   void setPixel(int16_t x, int16_t y) { Display::setPixel(Screen(), x, y); }
+
+   void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+   {
+      Display::drawLine(Screen(), x0, y0, x1, y1);
+   }
+
+   void drawRect(int16_t x, int16_t y, int16_t width, int16_t height)
+   {
+      Display::drawRect(Screen(), x, y, width, height);
+   }
+
+   void fillRect(int16_t x, int16_t y, int16_t width, int16_t height)
+   {
+      Display::fillRect(Screen(), x, y, width, height);
+   }
+
+   void drawCircle(int16_t x, int16_t y, int16_t radius) { Display::drawCircle(Screen(), x, y, radius); }
+
+   void drawCircleQuads(int16_t x0, int16_t y0, int16_t radius, uint8_t quads)
+   {
+      Display::drawCircleQuads(Screen(), x0, y0, radius, quads);
+   }
+
+   void fillCircle(int16_t x, int16_t y, int16_t radius) { Display::fillCircle(Screen(), x, y, radius); }
+
+   void drawHorizontalLine(int16_t x, int16_t y, int16_t length)
+   {
+      Display::drawHorizontalLine(Screen(), x, y, length);
+   }
+
+   void drawVerticalLine(int16_t x, int16_t y, int16_t length)
+   {
+      Display::drawVerticalLine(Screen(), x, y, length);
+   }
+
+   void drawRoundRect(int16_t x, int16_t y, int16_t width, int16_t height, int16_t radius)
+   {
+      Display::drawRoundRect(Screen(), x, y, width, height, radius);
+   }
+
+   void fillRoundRect(int16_t x, int16_t y, int16_t width, int16_t height, int16_t radius)
+   {
+      Display::fillRoundRect(Screen(), x, y, width, height, radius);
+   }
+
+  private:
+   // Word aligned like a malloc() block, fillPageRun() and the page hash
+   // work a word at a time
+   alignas(4) uint8_t frame[W * H / 8];
+#ifdef OLEDDISPLAY_DOUBLE_BUFFER
+   alignas(4) uint8_t backFrame[W * H / 8];
+#endif
+#ifdef OLEDDISPLAY_PAGE_HASH
+   uint32_t pageHashes[(H / 8) * ((W + OLEDDISPLAY_PAGE_HASH_SEGMENT - 1) / OLEDDISPLAY_PAGE_HASH_SEGMENT)];
+#endif
+};
+
+#endif
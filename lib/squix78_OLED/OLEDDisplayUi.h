@@ -38,6 +38,13 @@ enum AnimationDirection {
   SLIDE_RIGHT
 };
 
+// How the slide offsets follow the ticks of a transition
+enum AnimationEasing {
+  EASE_LINEAR,
+  EASE_IN_OUT,
+  EASE_BOUNCE
+};
+
 enum IndicatorPosition {
   TOP,
   RIGHT,
@@ -65,6 +72,41 @@ const char ANIMATION_inactiveSymbol[] PROGMEM = {
 };
 
 
+// Transitions run without floats (the Cortex-M0 has no FPU): the progress
+// is Q16, 0..65536 over the transition, stepped by a reciprocal of the
+// transition ticks. The curves are sampled at 65 points in Q8.8 (0..256)
+// and interpolated, they start at 0 and end at 256 exactly.
+const uint16_t ANIMATION_easeInOut[65] PROGMEM = {
+  0, 0, 0, 0, 0, 0, 1, 1, 2, 3, 4, 5, 7,
+  9, 11, 13, 16, 19, 23, 27, 31, 36, 42, 48, 54, 61,
+  69, 77, 86, 95, 105, 116, 128, 140, 151, 161, 170, 179, 187,
+  195, 202, 208, 214, 220, 225, 229, 233, 237, 240, 243, 245, 247,
+  249, 251, 252, 253, 254, 255, 255, 256, 256, 256, 256, 256, 256
+};
+
+const uint16_t ANIMATION_easeBounce[65] PROGMEM = {
+  0, 0, 2, 4, 8, 12, 17, 23, 30, 38, 47, 57, 68,
+  80, 93, 106, 121, 137, 153, 171, 189, 208, 229, 250, 248, 238,
+  230, 222, 215, 209, 203, 199, 196, 194, 192, 192, 193, 194, 197,
+  200, 204, 210, 216, 223, 231, 240, 250, 254, 249, 245, 243, 241,
+  240, 240, 241, 243, 246, 250, 255, 254, 253, 252, 252, 254, 256
+};
+
+// Eased Q16 position of the Q16 `progress` (0..65536)
+inline uint32_t animationEase(AnimationEasing easing, uint32_t progress) {
+  if (easing == EASE_LINEAR || progress >= 65536) return progress;
+  const uint16_t *curve = easing == EASE_IN_OUT ? ANIMATION_easeInOut : ANIMATION_easeBounce;
+  uint8_t index = progress >> 10;
+  int32_t low   = pgm_read_word(curve + index);
+  int32_t high  = pgm_read_word(curve + index + 1);
+  return (low << 8) + (((high - low) * (int32_t)(progress & 1023)) >> 2);
+}
+
+// `extent` pixels scaled by a Q16 position
+inline int16_t animationOffset(uint16_t extent, uint32_t position) {
+  return (int16_t)((extent * position) >> 16);
+}
+
 // Structure of the UiState
 struct OLEDDisplayUiState {
   uint64_t     lastUpdate                = 0;
@@ -113,6 +155,9 @@ class OLEDDisplayUi {
 
     uint16_t            ticksPerFrame             = 151; // ~ 5000ms at 30 FPS
     uint16_t            ticksPerTransition        = 15;  // ~  500ms at 30 FPS
+    uint32_t            transitionStep            = 4370; // Q16 progress per tick, 65536 / 15 rounded up
+
+    AnimationEasing     frameEasing               = EASE_LINEAR;
 
     bool                autoTransition            = true;
 
@@ -133,6 +178,24 @@ class OLEDDisplayUi {
     // 0 Not known yet
     uint8_t                indicatorDrawState        = 1;
 
+    // Both frames of a transition drawn once, current then next, and which
+    // frames they hold
+    uint8_t*            transitionBuffer          = NULL;
+    uint16_t            transitionBufferSize      = 0;
+    bool                transitionCaptured        = false;
+    uint8_t             capturedFrame             = 0;
+    uint8_t             capturedNextFrame         = 0;
+    // Columns each of them drew in, per page (min > max if none)
+    uint8_t             capturedInkMinX[2][OLEDDISPLAY_MAX_PAGES];
+    uint8_t             capturedInkMaxX[2][OLEDDISPLAY_MAX_PAGES];
+
+    // Vertical slides by the panel start line, over the next frame written
+    // to the GRAM rows the display doesn't show
+    bool                panelScroll               = false;
+    bool                panelScrolled             = false;
+    bool                scrolledUp                = false;
+    uint8_t             scrolledNextFrame         = 0;
+
     // Loading screen
     LoadingDrawFunction loadingDrawFunction       = [](OLEDDisplay *display, LoadingStage* stage, uint8_t progress) {
       display->setTextAlignment(TEXT_ALIGN_CENTER);
@@ -150,13 +213,20 @@ class OLEDDisplayUi {
     uint8_t             getNextFrameNumber();
     void                drawIndicator();
     void                drawFrame();
+    void                drawTransitionFrames(int16_t x, int16_t y, int16_t x1, int16_t y1, bool capture);
+    void                drawTransitionBuffers(int16_t x, int16_t y, int16_t x1, int16_t y1);
+    void                findCapturedInk(uint8_t index);
+    bool                scrollTransition();
     void                drawOverlays();
     void                tick();
     void                resetState();
+    void                setTicksPerTransition(uint16_t ticks);
+    uint32_t            transitionPosition();
 
   public:
 
     OLEDDisplayUi(OLEDDisplay *display);
+    ~OLEDDisplayUi();
 
     /**
      * Initialise the display
@@ -250,6 +320,36 @@ class OLEDDisplayUi {
      */
     void setFrameAnimation(AnimationDirection dir);
 
+    /**
+     * Configure how the frames move during a transition, EASE_LINEAR by default
+     */
+    void setFrameEasing(AnimationEasing easing);
+
+    /**
+     * Draw the two frames of a transition only once, into offscreen buffers
+     * (2 * width * height / 8 bytes), and slide those copies on the following
+     * ticks. The frames are still images while they slide, and they are cut
+     * at the screen edges.
+     * Returns false if the buffers can't be allocated. It also returns false
+     * with OLEDDISPLAY_DISPLAY_LIST, which has no framebuffer. In that case
+     * transitions call the frame functions on every tick as before.
+     */
+    bool enableTransitionBuffers();
+    void disableTransitionBuffers();
+
+    /**
+     * Let the panel do SLIDE_UP and SLIDE_DOWN transitions. The next frame is
+     * written once to the GRAM rows below the display, and each tick only
+     * moves the panel start line (one command byte). This needs a display at
+     * most 32 rows high, e.g. 64x32 or 128x32. Horizontal slides and higher
+     * displays use the software slide.
+     * While sliding, the current frame is frozen. Overlays slide with the
+     * frames, and the indicator of the next frame shows up when the slide
+     * ends.
+     */
+    void enablePanelScroll();
+    void disablePanelScroll();
+
     /**
      * Add frame drawing functions
      */
@@ -302,18 +402,22 @@ OLEDDisplayUi::OLEDDisplayUi(OLEDDisplay *display) {
   this->display = display;
 }
 
+OLEDDisplayUi::~OLEDDisplayUi() {
+  this->disableTransitionBuffers();
+}
+
 void OLEDDisplayUi::init() {
   this->display->init();
 }
 
 void OLEDDisplayUi::setTargetFPS(uint8_t fps){
-  float oldInterval = this->updateInterval;
-  this->updateInterval = ((float) 1.0 / (float) fps) * 1000;
+  if (fps == 0) return;
+  uint8_t oldInterval = this->updateInterval;
+  this->updateInterval = 1000 / fps;
 
-  // Calculate new ticksPerFrame
-  float changeRatio = oldInterval / (float) this->updateInterval;
-  this->ticksPerFrame *= changeRatio;
-  this->ticksPerTransition *= changeRatio;
+  // Scale the ticks to keep the times
+  this->ticksPerFrame = (uint32_t) this->ticksPerFrame * oldInterval / this->updateInterval;
+  this->setTicksPerTransition((uint32_t) this->ticksPerTransition * oldInterval / this->updateInterval);
 }
 
 // -/------ Automatic controll ------\-
@@ -333,10 +437,15 @@ void OLEDDisplayUi::setAutoTransitionBackwards(){
   this->lastTransitionDirection = -1;
 }
 void OLEDDisplayUi::setTimePerFrame(uint16_t time){
-  this->ticksPerFrame = (int) ( (float) time / (float) updateInterval);
+  this->ticksPerFrame = time / this->updateInterval;
 }
 void OLEDDisplayUi::setTimePerTransition(uint16_t time){
-  this->ticksPerTransition = (int) ( (float) time / (float) updateInterval);
+  this->setTicksPerTransition(time / this->updateInterval);
+}
+void OLEDDisplayUi::setTicksPerTransition(uint16_t ticks){
+  this->ticksPerTransition = ticks;
+  // The one division of a transition, rounded up so the last tick reaches 65536
+  this->transitionStep = ticks ? (65536 + ticks - 1) / ticks : 65536;
 }
 
 // -/------ Customize indicator position and style -------\-
@@ -374,6 +483,33 @@ void OLEDDisplayUi::setInactiveSymbol(const char* symbol) {
 void OLEDDisplayUi::setFrameAnimation(AnimationDirection dir) {
   this->frameAnimationDirection = dir;
 }
+void OLEDDisplayUi::setFrameEasing(AnimationEasing easing) {
+  this->frameEasing = easing;
+}
+bool OLEDDisplayUi::enableTransitionBuffers() {
+#ifdef OLEDDISPLAY_DISPLAY_LIST
+  return false;
+#else
+  this->disableTransitionBuffers();
+  uint16_t size = this->display->getDisplayWidth() * (this->display->getDisplayHeight() / 8);
+  this->transitionBuffer = (uint8_t*) malloc(2 * size);
+  if (!this->transitionBuffer) return false;
+  this->transitionBufferSize = size;
+  return true;
+#endif
+}
+void OLEDDisplayUi::enablePanelScroll() {
+  this->panelScroll = true;
+}
+void OLEDDisplayUi::disablePanelScroll() {
+  this->panelScroll = false;
+}
+void OLEDDisplayUi::disableTransitionBuffers() {
+  free(this->transitionBuffer);
+  this->transitionBuffer = NULL;
+  this->transitionBufferSize = 0;
+  this->transitionCaptured = false;
+}
 void OLEDDisplayUi::setFrames(FrameCallback* frameFunctions, uint8_t frameCount) {
   this->frameFunctions = frameFunctions;
   this->frameCount     = frameCount;
@@ -463,10 +599,10 @@ OLEDDisplayUiState* OLEDDisplayUi::getUiState(){
 
 int8_t OLEDDisplayUi::update(){
   long frameStart = millis();
-  int8_t timeBudget = this->updateInterval - (frameStart - this->state.lastUpdate);
+  int32_t timeBudget = this->updateInterval - (frameStart - this->state.lastUpdate);
   if ( timeBudget <= 0) {
     // Implement frame skipping to ensure time budget is keept
-    if (this->autoTransition && this->state.lastUpdate != 0) this->state.ticksSinceLastStateSwitch += ceil(-timeBudget / this->updateInterval);
+    if (this->autoTransition && this->state.lastUpdate != 0) this->state.ticksSinceLastStateSwitch += -timeBudget / this->updateInterval;
 
     this->state.lastUpdate = frameStart;
     this->tick();
@@ -485,6 +621,7 @@ void OLEDDisplayUi::tick() {
           this->state.currentFrame = getNextFrameNumber();
           this->state.ticksSinceLastStateSwitch = 0;
           this->nextFrameNumber = -1;
+          this->transitionCaptured = false;
         }
       break;
     case FIXED:
@@ -502,6 +639,10 @@ void OLEDDisplayUi::tick() {
       break;
   }
 
+  if (this->state.frameState == IN_TRANSITION && this->scrollTransition()) return;
+
+  // After a panel scroll the GRAM holds both frames, write all of it
+  if (this->panelScrolled) this->display->invalidate();
   this->display->clear();
   this->drawFrame();
   if (shouldDrawIndicators) {
@@ -509,9 +650,45 @@ void OLEDDisplayUi::tick() {
   }
   this->drawOverlays();
   this->display->display();
+  if (this->panelScrolled) {
+    this->display->setStartLine(0);
+    this->panelScrolled = false;
+  }
+}
+
+// Moves the panel start line towards the next frame, which is written below
+// (SLIDE_UP) or above (SLIDE_DOWN, wrapping around) the visible rows first.
+// Returns false if the panel can't do this slide
+bool OLEDDisplayUi::scrollTransition() {
+  uint8_t height = this->display->getDisplayHeight();
+  if (!this->panelScroll || height > 32 ||
+      (this->frameAnimationDirection != SLIDE_UP && this->frameAnimationDirection != SLIDE_DOWN)) {
+    return false;
+  }
+
+  bool up = (this->frameAnimationDirection == SLIDE_UP) == (this->state.frameTransitionDirection >= 0);
+  uint8_t nextFrame = this->getNextFrameNumber();
+  if (!this->panelScrolled || this->scrolledNextFrame != nextFrame || this->scrolledUp != up) {
+    this->display->clear();
+    this->enableIndicator();
+    (this->frameFunctions[nextFrame])(this->display, &this->state, 0, 0);
+    this->drawOverlays();
+    this->display->setGramPage(up ? height / 8 : 8 - height / 8);
+    this->display->invalidate();
+    this->display->display();
+    this->display->setGramPage(0);
+    this->panelScrolled = true;
+    this->scrolledNextFrame = nextFrame;
+    this->scrolledUp = up;
+  }
+
+  uint8_t offset = animationOffset(height, this->transitionPosition());
+  this->display->setStartLine(up ? offset : 64 - offset);
+  return true;
 }
 
 void OLEDDisplayUi::resetState() {
+  this->transitionCaptured = false;
   this->state.lastUpdate = 0;
   this->state.ticksSinceLastStateSwitch = 0;
   this->state.frameState = FIXED;
@@ -519,33 +696,39 @@ void OLEDDisplayUi::resetState() {
   this->state.isIndicatorDrawen = true;
 }
 
+// Eased Q16 position of the running transition
+uint32_t OLEDDisplayUi::transitionPosition() {
+  uint32_t progress = (uint32_t) this->state.ticksSinceLastStateSwitch * this->transitionStep;
+  return animationEase(this->frameEasing, progress < 65536 ? progress : 65536);
+}
+
 void OLEDDisplayUi::drawFrame(){
   switch (this->state.frameState){
      case IN_TRANSITION: {
-       float progress = (float) this->state.ticksSinceLastStateSwitch / (float) this->ticksPerTransition;
-       int16_t x, y, x1, y1;
+       uint32_t position = this->transitionPosition();
+       int16_t x = 0, y = 0, x1 = 0, y1 = 0;
        switch(this->frameAnimationDirection){
         case SLIDE_LEFT:
-          x = -display->getDisplayWidth() * progress;
+          x = -animationOffset(display->getDisplayWidth(), position);
           y = 0;
           x1 = x + display->getDisplayWidth();
           y1 = 0;
           break;
         case SLIDE_RIGHT:
-          x = display->getDisplayWidth() * progress;
+          x = animationOffset(display->getDisplayWidth(), position);
           y = 0;
           x1 = x - display->getDisplayWidth();
           y1 = 0;
           break;
         case SLIDE_UP:
           x = 0;
-          y = -display->getDisplayHeight() * progress;
+          y = -animationOffset(display->getDisplayHeight(), position);
           x1 = 0;
           y1 = y + display->getDisplayHeight();
           break;
         case SLIDE_DOWN:
           x = 0;
-          y = display->getDisplayHeight() * progress;
+          y = animationOffset(display->getDisplayHeight(), position);
           x1 = 0;
           y1 = y - display->getDisplayHeight();
           break;
@@ -555,33 +738,23 @@ void OLEDDisplayUi::drawFrame(){
        int8_t dir = this->state.frameTransitionDirection >= 0 ? 1 : -1;
        x *= dir; y *= dir; x1 *= dir; y1 *= dir;
 
-       bool drawenCurrentFrame;
-
-
-       // Prope each frameFunction for the indicator Drawen state
-       this->enableIndicator();
-       (this->frameFunctions[this->state.currentFrame])(this->display, &this->state, x, y);
-       drawenCurrentFrame = this->state.isIndicatorDrawen;
-
-       this->enableIndicator();
-       (this->frameFunctions[this->getNextFrameNumber()])(this->display, &this->state, x1, y1);
-
-       // Build up the indicatorDrawState
-       if (drawenCurrentFrame && !this->state.isIndicatorDrawen) {
-         // Drawen now but not next
-         this->indicatorDrawState = 2;
-       } else if (!drawenCurrentFrame && this->state.isIndicatorDrawen) {
-         // Not drawen now but next
-         this->indicatorDrawState = 1;
-       } else if (!drawenCurrentFrame && !this->state.isIndicatorDrawen) {
-         // Not drawen in both frames
-         this->indicatorDrawState = 3;
+       uint16_t frameSize = this->display->getDisplayWidth() * (this->display->getDisplayHeight() / 8);
+       if (!this->transitionBuffer || frameSize != this->transitionBufferSize) {
+         this->drawTransitionFrames(x, y, x1, y1, false);
+         break;
        }
 
-       // If the indicator isn't draw in the current frame
-       // reflect it in state.isIndicatorDrawen
-       if (!drawenCurrentFrame) this->state.isIndicatorDrawen = false;
-
+       // Draw the frames once, then only slide them. A transitionToFrame()
+       // while sliding changes the next frame
+       uint8_t nextFrame = this->getNextFrameNumber();
+       if (!this->transitionCaptured || this->capturedFrame != this->state.currentFrame ||
+           this->capturedNextFrame != nextFrame) {
+         this->drawTransitionFrames(0, 0, 0, 0, true);
+         this->transitionCaptured = true;
+         this->capturedFrame = this->state.currentFrame;
+         this->capturedNextFrame = nextFrame;
+       }
+       this->drawTransitionBuffers(x, y, x1, y1);
        break;
      }
      case FIXED:
@@ -594,6 +767,117 @@ void OLEDDisplayUi::drawFrame(){
   }
 }
 
+// Draws both frames of the transition and works out from them whether the
+// indicator slides. With `capture` the frames are copied to the transition
+// buffers, each drawn alone
+void OLEDDisplayUi::drawTransitionFrames(int16_t x, int16_t y, int16_t x1, int16_t y1, bool capture) {
+  bool drawenCurrentFrame;
+
+  // Prope each frameFunction for the indicator Drawen state
+  this->enableIndicator();
+  (this->frameFunctions[this->state.currentFrame])(this->display, &this->state, x, y);
+  drawenCurrentFrame = this->state.isIndicatorDrawen;
+  if (capture) {
+    memcpy(this->transitionBuffer, this->display->buffer, this->transitionBufferSize);
+    this->findCapturedInk(0);
+    this->display->clear();
+  }
+
+  this->enableIndicator();
+  (this->frameFunctions[this->getNextFrameNumber()])(this->display, &this->state, x1, y1);
+  if (capture) {
+    memcpy(this->transitionBuffer + this->transitionBufferSize, this->display->buffer, this->transitionBufferSize);
+    this->findCapturedInk(1);
+  }
+
+  // Build up the indicatorDrawState
+  if (drawenCurrentFrame && !this->state.isIndicatorDrawen) {
+    // Drawen now but not next
+    this->indicatorDrawState = 2;
+  } else if (!drawenCurrentFrame && this->state.isIndicatorDrawen) {
+    // Not drawen now but next
+    this->indicatorDrawState = 1;
+  } else if (!drawenCurrentFrame && !this->state.isIndicatorDrawen) {
+    // Not drawen in both frames
+    this->indicatorDrawState = 3;
+  }
+
+  // If the indicator isn't draw in the current frame
+  // reflect it in state.isIndicatorDrawen
+  if (!drawenCurrentFrame) this->state.isIndicatorDrawen = false;
+}
+
+// Composites the frames in the transition buffers at their slide offsets,
+// side by side or one above the other
+void OLEDDisplayUi::drawTransitionBuffers(int16_t x, int16_t y, int16_t x1, int16_t y1) {
+  uint8_t width = this->display->getDisplayWidth();
+  uint8_t pages = this->display->getDisplayHeight() / 8;
+  uint8_t *current = this->transitionBuffer;
+  uint8_t *next = this->transitionBuffer + this->transitionBufferSize;
+  uint8_t *target = this->display->buffer;
+
+  if (this->frameAnimationDirection == SLIDE_LEFT || this->frameAnimationDirection == SLIDE_RIGHT) {
+    // The screen starts `offset` columns into the left frame
+    uint8_t *left = x < x1 ? current : next;
+    uint8_t *right = x < x1 ? next : current;
+    uint8_t offset = x < x1 ? -x : -x1;
+    for (uint8_t page = 0; page < pages; page++) {
+      memcpy(target, left + offset, width - offset);
+      memcpy(target + width - offset, right, offset);
+      target += width;
+      left += width;
+      right += width;
+    }
+  } else {
+    // The screen starts `offset` rows into the top frame, a page of it is
+    // made of two source pages unless that is a multiple of 8
+    uint8_t *top = y < y1 ? current : next;
+    uint8_t *bottom = y < y1 ? next : current;
+    uint8_t offset = y < y1 ? -y : -y1;
+    uint8_t shift = offset & 7;
+    for (uint8_t page = 0; page < pages; page++) {
+      uint8_t source = page + (offset >> 3);
+      uint8_t *upper = source < pages ? top + source * width : bottom + (source - pages) * width;
+      if (!shift) {
+        memcpy(target, upper, width);
+      } else {
+        source++;
+        uint8_t *lower = source < pages ? top + source * width : bottom + (source - pages) * width;
+        for (uint8_t column = 0; column < width; column++) {
+          target[column] = (upper[column] >> shift) | (lower[column] << (8 - shift));
+        }
+      }
+      target += width;
+    }
+  }
+
+  // Send the drawn columns of every page where they are now, what they
+  // covered on the last tick is still dirty from clear()
+  for (uint8_t page = 0; page < pages; page++) {
+    uint8_t minX = this->capturedInkMinX[0][page], maxX = this->capturedInkMaxX[0][page];
+    this->display->invalidate(minX + x, page * 8 + y, maxX - minX + 1, 8);
+    minX = this->capturedInkMinX[1][page];
+    maxX = this->capturedInkMaxX[1][page];
+    this->display->invalidate(minX + x1, page * 8 + y1, maxX - minX + 1, 8);
+  }
+}
+
+void OLEDDisplayUi::findCapturedInk(uint8_t index) {
+  uint8_t width = this->display->getDisplayWidth();
+  uint8_t pages = this->display->getDisplayHeight() / 8;
+  const uint8_t *frame = this->transitionBuffer + index * this->transitionBufferSize;
+  for (uint8_t page = 0; page < pages; page++) {
+    uint8_t minX = 0xFF, maxX = 0;
+    for (uint8_t column = 0; column < width; column++) {
+      if (!*frame++) continue;
+      if (minX == 0xFF) minX = column;
+      maxX = column;
+    }
+    this->capturedInkMinX[index][page] = minX;
+    this->capturedInkMaxX[index][page] = maxX;
+  }
+}
+
 void OLEDDisplayUi::drawIndicator() {
 
     // Only draw if the indicator is invisible
@@ -604,7 +888,8 @@ void OLEDDisplayUi::drawIndicator() {
     }
 
     uint8_t posOfHighlightFrame;
-    float indicatorFadeProgress = 0;
+    // How far the indicator is slid out, in pixels (it is 8 high)
+    int16_t indicatorFade = 0;
 
     // if the indicator needs to be slided in we want to
     // highlight the next frame in the transition
@@ -624,34 +909,34 @@ void OLEDDisplayUi::drawIndicator() {
     switch (this->indicatorDrawState) {
       case 1: // Indicator was not drawn in this frame but will be in next
         // Slide IN
-        indicatorFadeProgress = 1 - ((float) this->state.ticksSinceLastStateSwitch / (float) this->ticksPerTransition);
+        indicatorFade = 8 - animationOffset(8, this->transitionPosition());
         break;
       case 2: // Indicator was drawn in this frame but not in next
         // Slide OUT
-        indicatorFadeProgress = ((float) this->state.ticksSinceLastStateSwitch / (float) this->ticksPerTransition);
+        indicatorFade = animationOffset(8, this->transitionPosition());
         break;
     }
 
     uint16_t frameStartPos = (12 * frameCount / 2);
     const char *image;
-    uint16_t x,y;
+    int16_t x = 0, y = 0;
     for (byte i = 0; i < this->frameCount; i++) {
 
       switch (this->indicatorPosition){
         case TOP:
-          y = 0 - (8 * indicatorFadeProgress);
+          y = 0 - indicatorFade;
           x = 64 - frameStartPos + 12 * i;
           break;
         case BOTTOM:
-          y = 56 + (8 * indicatorFadeProgress);
+          y = 56 + indicatorFade;
           x = 64 - frameStartPos + 12 * i;
           break;
         case RIGHT:
-          x = 120 + (8 * indicatorFadeProgress);
+          x = 120 + indicatorFade;
           y = 32 - frameStartPos + 2 + 12 * i;
           break;
         case LEFT:
-          x = 0 - (8 * indicatorFadeProgress);
+          x = 0 - indicatorFade;
           y = 32 - frameStartPos + 2 + 12 * i;
           break;
       }
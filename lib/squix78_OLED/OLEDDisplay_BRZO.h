@@ -56,6 +56,23 @@ void OLEDDisplay::sendCommand(uint8_t command)
   brzo_i2c_end_transaction();
 }
 
+void OLEDDisplay::sendCommands(const uint8_t *commands, uint8_t length)
+{
+  // A control byte of 0x00 (Co = 0) makes every following byte a command
+  uint8_t _commands[length + 1];
+  _commands[0] = 0x00;
+  memcpy(&_commands[1], commands, length);
+  brzo_i2c_start_transaction(_address, BRZO_I2C_SPEED);
+  brzo_i2c_write(_commands, length + 1, true);
+  brzo_i2c_end_transaction();
+}
+
+void OLEDDisplay::sendFlushStep(const OLEDFlushStep &step)
+{
+  if (step.commandLength) sendCommands(step.commands, step.commandLength);
+  sendBufferChunks(step.dataStart, step.dataLength);
+}
+
 void OLEDDisplay::sendData(uint8_t data, uint16_t len)
 {
   brzo_i2c_start_transaction(_address, BRZO_I2C_SPEED);
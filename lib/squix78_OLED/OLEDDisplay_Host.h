@@ -0,0 +1,399 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2016 by Daniel Eichhorn
+ * Copyright (c) 2016 by Fabrice Weinberg
+ * Copyright (c) 2017 by Mark Cooke
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Credits for parts of this code go to Mike Rankin. Thank you so much for sharing!
+ */
+
+#ifndef OLEDDisplay_Host
+#define OLEDDisplay_Host
+
+#include "OLEDDisplay.h"
+#include <vector>
+
+// Linux host backend. Instead of driving SPI it records every byte that would
+// have been clocked out (with the level of DC at the time) and feeds it into a
+// small SSD1306/SH1106 GRAM model, so rendering and transport changes can be
+// measured and checked without a watch on the desk.
+
+#define OLEDHOST_GRAM_COLUMNS 132
+#define OLEDHOST_GRAM_PAGES 8
+
+class OLEDHostPanel
+{
+  public:
+   uint8_t gram[OLEDHOST_GRAM_PAGES][OLEDHOST_GRAM_COLUMNS];
+   uint8_t startLine;  // GRAM row shown at the top
+
+   // Byte `column` of visible page `page`, the rows from startLine on
+   uint8_t visibleByte(uint8_t page, uint8_t column)
+   {
+      uint8_t row   = (startLine + page * 8) & (OLEDHOST_GRAM_PAGES * 8 - 1);
+      uint8_t shift = row & 7;
+      uint8_t upper = gram[row >> 3][column];
+      if (!shift) return upper;
+      uint8_t lower = gram[((row >> 3) + 1) & (OLEDHOST_GRAM_PAGES - 1)][column];
+      return (upper >> shift) | (lower << (8 - shift));
+   }
+
+   void reset()
+   {
+      memset(gram, 0, sizeof(gram));
+      col = page = 0;
+      startLine = 0;
+      colStart = pageStart = 0;
+      colEnd = OLEDHOST_GRAM_COLUMNS - 1;
+      pageEnd = OLEDHOST_GRAM_PAGES - 1;
+      pageAddressing = true;
+      argsPending = 0;
+   }
+
+   void write(bool isData, uint8_t value)
+   {
+      if (isData)
+      {
+         writeData(value);
+      }
+      else if (argsPending)
+      {
+         args[argCount++] = value;
+         if (--argsPending == 0) runCommand();
+      }
+      else
+      {
+         command = value;
+         argCount = 0;
+         argsPending = argumentCount(value);
+         if (argsPending == 0) runCommand();
+      }
+   }
+
+  private:
+   uint8_t col, page;
+   uint8_t colStart, colEnd, pageStart, pageEnd;
+   bool pageAddressing;
+
+   uint8_t command;
+   uint8_t args[8];
+   uint8_t argCount, argsPending;
+
+   static uint8_t argumentCount(uint8_t cmd)
+   {
+      switch (cmd)
+      {
+         case COLUMNADDR:
+         case PAGEADDR:
+         case 0xA3:  // vertical scroll area
+            return 2;
+         case 0x26:  // horizontal scroll setup
+         case 0x27:
+            return 6;
+         case 0x29:  // vertical and horizontal scroll setup
+         case 0x2A:
+            return 5;
+         case MEMORYMODE:
+         case SETCONTRAST:
+         case CHARGEPUMP:
+         case SETMULTIPLEX:
+         case SETDISPLAYOFFSET:
+         case SETDISPLAYCLOCKDIV:
+         case SETPRECHARGE:
+         case SETCOMPINS:
+         case SETVCOMDETECT:
+         case 0xAD:  // SH1106 pump mode
+            return 1;
+      }
+      return 0;
+   }
+
+   void runCommand()
+   {
+      if (command == COLUMNADDR)
+      {
+         colStart = col = args[0];
+         colEnd = args[1];
+         pageAddressing = false;
+      }
+      else if (command == PAGEADDR)
+      {
+         pageStart = page = args[0] & 7;
+         pageEnd = args[1] & 7;
+         pageAddressing = false;
+      }
+      else if (command <= 0x0F)
+      {
+         col = (col & 0xF0) | command;
+      }
+      else if (command <= 0x1F)
+      {
+         col = (col & 0x0F) | ((command & 0x0F) << 4);
+      }
+      else if ((command & 0xC0) == SETSTARTLINE)
+      {
+         startLine = command & 0x3F;
+      }
+      else if ((command & 0xF8) == 0xB0)
+      {
+         page = command & 7;
+         pageAddressing = true;
+      }
+   }
+
+   void writeData(uint8_t value)
+   {
+      if (col < OLEDHOST_GRAM_COLUMNS) gram[page][col] = value;
+      if (pageAddressing)
+      {
+         col++;
+         return;
+      }
+      if (col++ >= colEnd)
+      {
+         col = colStart;
+         page = (page >= pageEnd) ? pageStart : page + 1;
+      }
+   }
+};
+
+class OLEDHostBus
+{
+  public:
+   // One entry per byte on the wire, bit 8 holds DC (1 = data)
+   std::vector<uint16_t> trace;
+   bool recordTrace = true;
+
+   uint32_t commandBytes = 0;
+   uint32_t dataBytes    = 0;
+   uint32_t csAssertions = 0;
+   uint32_t dcEdges      = 0;
+
+   OLEDHostPanel panel;
+
+   // Model of the nRF51 SPI used by displayAsync(): TXD is double buffered,
+   // every byte shifted out raises READY. READY stays pending while the
+   // interrupt is masked or its handler is running, like on the NVIC
+   OLEDDisplay *asyncDisplay = NULL;
+   uint8_t txd[2];
+   uint8_t txdCount     = 0;
+   uint32_t txdOverruns = 0;  // TXD written while both stages were full
+   uint32_t strayWrites = 0;  // TXD written after the flush finished
+   uint32_t interrupts  = 0;
+   bool interruptEnabled = false;
+   bool inInterrupt      = false;
+   uint8_t readyPending  = 0;
+   // Shift every byte out the moment it is written to TXD. Its READY
+   // preempts the code that loaded it at the next write, between the
+   // bookkeeping of two bytes
+   bool instantTransfer = false;
+
+   void reset()
+   {
+      resetCounters();
+      panel.reset();
+      dc = LOW;
+      cs = HIGH;
+      asyncDisplay = NULL;
+      txdCount     = 0;
+      interruptEnabled = false;
+      readyPending     = 0;
+   }
+
+   void resetCounters()
+   {
+      trace.clear();
+      commandBytes = dataBytes = csAssertions = dcEdges = 0;
+      txdOverruns = strayWrites = interrupts = 0;
+   }
+
+   void setDC(uint8_t level)
+   {
+      if (dc != level) dcEdges++;
+      dc = level;
+   }
+
+   void setCS(uint8_t level)
+   {
+      if (cs == HIGH && level == LOW) csAssertions++;
+      cs = level;
+   }
+
+   void transfer(uint8_t value)
+   {
+      if (cs != LOW) return;  // not selected, the panel ignores the clock
+      if (recordTrace) trace.push_back(((uint16_t)dc << 8) | value);
+      if (dc == HIGH)
+         dataBytes++;
+      else
+         commandBytes++;
+      panel.write(dc == HIGH, value);
+   }
+
+   void writeTXD(uint8_t value)
+   {
+      if (instantTransfer) serviceInterrupt();
+      if (!asyncDisplay)
+      {
+         strayWrites++;
+         return;
+      }
+      if (txdCount == 2)
+      {
+         txdOverruns++;
+         return;
+      }
+      txd[txdCount++] = value;
+      if (instantTransfer) shiftByte();
+   }
+
+   // Shift out the oldest byte in TXD with the DC level of this moment and
+   // run the READY interrupt. Returns false when the transmitter is idle
+   bool clockByte()
+   {
+      if (!txdCount) return false;
+      shiftByte();
+      serviceInterrupt();
+      return true;
+   }
+
+   void shiftByte()
+   {
+      transfer(txd[0]);
+      txd[0] = txd[1];
+      txdCount--;
+      readyPending++;
+   }
+
+   void enableInterrupt()
+   {
+      interruptEnabled = true;
+      serviceInterrupt();
+   }
+
+   void disableInterrupt()
+   {
+      interruptEnabled = false;
+      readyPending     = 0;
+   }
+
+   // Run the handler for every pending READY unless it is masked or already
+   // running, events raised by the handler itself are tail-chained
+   void serviceInterrupt()
+   {
+      if (!interruptEnabled || inInterrupt) return;
+      inInterrupt = true;
+      while (readyPending && asyncDisplay)
+      {
+         readyPending--;
+         interrupts++;
+         asyncDisplay->asyncInterrupt();
+      }
+      inInterrupt = false;
+   }
+
+  private:
+   uint8_t dc = LOW;
+   uint8_t cs = HIGH;
+};
+
+OLEDHostBus oledHostBus;
+
+void OLEDDisplay::rawDataWrite(uint8_t data) { oledHostBus.transfer(data); }
+void OLEDDisplay::startDataWrite() { oledHostBus.setDC(HIGH); oledHostBus.setCS(LOW); }
+void OLEDDisplay::endDataWrite() { oledHostBus.setCS(HIGH); }
+
+bool OLEDDisplay::connect(uint32_t)
+{
+  oledHostBus.reset();
+  return true;
+}
+
+#ifdef OLEDDISPLAY_ASYNC_TRANSPORT
+void OLEDDisplay::asyncStart()
+{
+  oledHostBus.asyncDisplay = this;
+  oledHostBus.setCS(LOW);
+}
+
+void OLEDDisplay::asyncEnableInterrupt() { oledHostBus.enableInterrupt(); }
+
+void OLEDDisplay::asyncSetDC(bool isData) { oledHostBus.setDC(isData ? HIGH : LOW); }
+
+void OLEDDisplay::asyncTransmit(uint8_t value) { oledHostBus.writeTXD(value); }
+
+void OLEDDisplay::asyncFinish()
+{
+  oledHostBus.disableInterrupt();
+  oledHostBus.asyncDisplay = NULL;
+  oledHostBus.setCS(HIGH);
+}
+#endif
+
+void OLEDDisplay::sendCommand(uint8_t command)
+{
+  oledHostBus.setDC(LOW); // DC LOW for command
+  oledHostBus.setCS(LOW);
+  oledHostBus.transfer(command);
+  oledHostBus.setCS(HIGH);
+}
+
+void OLEDDisplay::sendCommands(const uint8_t *commands, uint8_t length)
+{
+  oledHostBus.setDC(LOW); // DC LOW for commands
+  oledHostBus.setCS(LOW);
+  for (uint8_t i = 0; i < length; ++i) { oledHostBus.transfer(commands[i]); }
+  oledHostBus.setCS(HIGH);
+}
+
+void OLEDDisplay::sendFlushStep(const OLEDFlushStep &step)
+{
+  oledHostBus.setCS(LOW);
+  if (step.commandLength)
+  {
+    oledHostBus.setDC(LOW);
+    for (uint8_t i = 0; i < step.commandLength; ++i) { oledHostBus.transfer(step.commands[i]); }
+  }
+  oledHostBus.setDC(HIGH);
+  const uint8_t *data = buffer + step.dataStart;
+  const uint8_t *end  = data + step.dataLength;
+  while (data < end) { oledHostBus.transfer(*data++); }
+  oledHostBus.setCS(HIGH);
+}
+
+void OLEDDisplay::sendData(uint8_t data, uint16_t len)
+{
+  oledHostBus.setDC(HIGH);  // DC HIGH for data
+  oledHostBus.setCS(LOW);
+  for (uint16_t i = 0; i < len; ++i) { oledHostBus.transfer(data);}
+  oledHostBus.setCS(HIGH);
+}
+
+void OLEDDisplay::sendData(uint8_t * data, uint16_t startIdx, uint16_t len)
+{
+  oledHostBus.setDC(HIGH);  // DC HIGH for data
+  oledHostBus.setCS(LOW);
+  for (uint16_t i = startIdx; i < startIdx+len; ++i) { oledHostBus.transfer(data[i]);}
+  oledHostBus.setCS(HIGH);
+}
+
+#endif
@@ -88,6 +88,24 @@ void OLEDDisplay::sendCommand(uint8_t command)
   squix78_OLED_Wire.endTransmission();
 }
 
+void OLEDDisplay::sendCommands(const uint8_t *commands, uint8_t length)
+{
+  // A control byte of 0x00 (Co = 0) makes every following byte a command
+  squix78_OLED_Wire.beginTransmission(_address);
+  squix78_OLED_Wire.write((uint8_t)0x00);
+  for (uint8_t i = 0; i < length; ++i)
+  {
+    squix78_OLED_Wire.write(commands[i]);
+  }
+  squix78_OLED_Wire.endTransmission();
+}
+
+void OLEDDisplay::sendFlushStep(const OLEDFlushStep &step)
+{
+  if (step.commandLength) sendCommands(step.commands, step.commandLength);
+  sendBufferChunks(step.dataStart, step.dataLength);
+}
+
 void OLEDDisplay::sendData(uint8_t data, uint16_t len)
 {
   squix78_OLED_Wire.beginTransmission(_address);
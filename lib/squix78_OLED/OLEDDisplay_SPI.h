@@ -31,13 +31,18 @@
 
 #include "OLEDDisplay.h"
 #include <SPI.h>
+#include <FastPin.h>
 
 // Configure SPI settings - Max clk frequency for display is 10MHz
 SPISettings oledSettings(10000000, MSBFIRST, SPI_MODE0);
 
+// DC and CS are toggled around every transfer, resolve them once in connect()
+FastPinMask oledDC;
+FastPinMask oledCS;
+
 void OLEDDisplay::rawDataWrite(uint8_t data) { SPI.transfer(data); }
-void OLEDDisplay::startDataWrite() { digitalWrite(_dc, HIGH); digitalWrite(_cs, LOW); }
-void OLEDDisplay::endDataWrite() { digitalWrite(_cs, HIGH); }
+void OLEDDisplay::startDataWrite() { oledDC.high(); oledCS.low(); }
+void OLEDDisplay::endDataWrite() { oledCS.high(); }
 
 bool OLEDDisplay::connect(uint32_t baudrate)
 {
@@ -48,11 +53,13 @@ bool OLEDDisplay::connect(uint32_t baudrate)
   }
   pinMode(_dc, OUTPUT);
   pinMode(_cs, OUTPUT);
+  oledDC.begin(_dc);
+  oledCS.begin(_cs);
   pinMode(MOSI, OUTPUT);
   pinMode(SCK, OUTPUT);
 
-  digitalWrite(_dc, LOW);
-  digitalWrite(_cs, HIGH);
+  oledDC.low();
+  oledCS.high();
   
   SPI.begin();
   #ifdef SPI_HAS_TRANSACTION
@@ -78,26 +85,95 @@ bool OLEDDisplay::connect(uint32_t baudrate)
 void OLEDDisplay::sendCommand(uint8_t command)
 {
   //digitalWrite(_cs, HIGH);
-  digitalWrite(_dc, LOW); // DC LOW for command
-  digitalWrite(_cs, LOW);
+  oledDC.low(); // DC LOW for command
+  oledCS.low();
   SPI.transfer(command);
-  digitalWrite(_cs, HIGH);
+  oledCS.high();
+}
+
+void OLEDDisplay::sendCommands(const uint8_t *commands, uint8_t length)
+{
+  oledDC.low(); // DC LOW for commands
+  oledCS.low();
+  for (uint8_t i = 0; i < length; ++i) { SPI.transfer(commands[i]); }
+  oledCS.high();
+}
+
+void OLEDDisplay::sendFlushStep(const OLEDFlushStep &step)
+{
+  // SPI.transfer() returns once the byte is out, so DC may flip right after
+  oledCS.low();
+  if (step.commandLength)
+  {
+    oledDC.low();
+    for (uint8_t i = 0; i < step.commandLength; ++i) { SPI.transfer(step.commands[i]); }
+  }
+  oledDC.high();
+  const uint8_t *data = buffer + step.dataStart;
+  const uint8_t *end  = data + step.dataLength;
+  while (data < end) { SPI.transfer(*data++); }
+  oledCS.high();
 }
 
 void OLEDDisplay::sendData(uint8_t data, uint16_t len)
 {
-  digitalWrite(_dc, HIGH);  // DC HIGH for data
-  digitalWrite(_cs, LOW);
+  oledDC.high();  // DC HIGH for data
+  oledCS.low();
   for (uint16_t i = 0; i < len; ++i) { SPI.transfer(data);}
-  digitalWrite(_cs, HIGH);
+  oledCS.high();
 }
 
 void OLEDDisplay::sendData(uint8_t * data, uint16_t startIdx, uint16_t len)
 {
-  digitalWrite(_dc, HIGH);  // DC HIGH for data
-  digitalWrite(_cs, LOW);
+  oledDC.high();  // DC HIGH for data
+  oledCS.low();
   for (uint16_t i = startIdx; i < startIdx+len; ++i) { SPI.transfer(data[i]);}
-  digitalWrite(_cs, HIGH);
+  oledCS.high();
+}
+
+#ifdef OLEDDISPLAY_ASYNC_TRANSPORT
+// displayAsync() on the nRF51: SPI (the instance the Arduino SPI object
+// uses, SPI0) has a two byte deep TXD, every READY event frees a stage and
+// the interrupt refills it. SPI0 shares its interrupt with TWI0, Wire is on
+// TWI1. Priority 3 is the lowest an application may use next to the
+// SoftDevice.
+OLEDDisplay *oledAsyncDisplay = NULL;
+
+void OLEDDisplay::asyncStart()
+{
+  oledAsyncDisplay = this;
+  oledCS.low();
+  NRF_SPI0->EVENTS_READY = 0;
+  NRF_SPI0->INTENSET = SPI_INTENSET_READY_Msk;
+  NVIC_ClearPendingIRQ(SPI0_TWI0_IRQn);
+  NVIC_SetPriority(SPI0_TWI0_IRQn, 3);
 }
 
+// READY events raised while displayAsync() loaded TXD are pending by now
+// and run as soon as the interrupt is enabled
+void OLEDDisplay::asyncEnableInterrupt() { NVIC_EnableIRQ(SPI0_TWI0_IRQn); }
+
+void OLEDDisplay::asyncSetDC(bool isData) { oledDC.write(isData); }
+
+void OLEDDisplay::asyncTransmit(uint8_t value) { NRF_SPI0->TXD = value; }
+
+void OLEDDisplay::asyncFinish()
+{
+  NRF_SPI0->INTENCLR = SPI_INTENCLR_READY_Msk;
+  NVIC_DisableIRQ(SPI0_TWI0_IRQn);
+  oledCS.high();
+  oledAsyncDisplay = NULL;
+}
+
+extern "C" void SPI0_TWI0_IRQHandler(void)
+{
+  if (NRF_SPI0->EVENTS_READY)
+  {
+    NRF_SPI0->EVENTS_READY = 0;
+    (void)NRF_SPI0->RXD;  // frees RXD for the next READY
+    if (oledAsyncDisplay) oledAsyncDisplay->asyncInterrupt();
+  }
+}
+#endif
+
 #endif
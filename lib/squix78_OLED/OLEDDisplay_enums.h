@@ -30,7 +30,7 @@
 #define OLEDDisplay_enums_h
 
 /*
-typedef enum OLED_MODE { MODE_SPI, MODE_I2C, MODE_BRZO } oled_mode;
+typedef enum OLED_MODE { MODE_SPI, MODE_I2C, MODE_BRZO, MODE_HOST } oled_mode;
 typedef enum OLED_TYPE { TYPE_SSD1306 = 0, TYPE_SH1106 = 2 } oled_type;
 typedef enum OLED_DISPLAYMODE { DISPLAY_NORMAL, DISPLAY_PAGED } oled_displaymode;
 */
@@ -38,6 +38,7 @@ typedef enum OLED_DISPLAYMODE { DISPLAY_NORMAL, DISPLAY_PAGED } oled_displaymode
 #define OLEDDISPLAY_MODE_SPI 0
 #define OLEDDISPLAY_MODE_I2C 1
 #define OLEDDISPLAY_MODE_BRZO 2
+#define OLEDDISPLAY_MODE_HOST 3
 
 #define OLEDDISPLAY_TYPE_SSD1306 0
 #define OLEDDISPLAY_TYPE_SH1106 2
@@ -0,0 +1,82 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2016 by Daniel Eichhorn
+ * Copyright (c) 2016 by Fabrice Weinberg
+ * Copyright (c) 2017 by Mark Cooke
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Credits for parts of this code go to Mike Rankin. Thank you so much for sharing!
+ */
+
+#ifndef SSD1306Host_h
+#define SSD1306Host_h
+
+#include "OLEDDisplay_enums.h"
+
+#define OLEDDISPLAY_MODE OLEDDISPLAY_MODE_HOST
+#define OLEDDISPLAY_CHIPSET OLEDDISPLAY_TYPE_SSD1306
+
+#include "OLEDDisplay.h"
+#include "OLEDDisplay_Host.h"
+
+// SSD1306 on a simulated SPI bus, for host side benchmarks and checks.
+// Build with the host Arduino shim: g++ -funsigned-char -Ihost -I. ...
+class SSD1306Host : public OLEDDisplay
+{
+  public:
+   SSD1306Host()
+   {
+      this->_rst = -1;
+      this->_dc  = 0;
+      this->_cs  = 0;
+   }
+
+   OLEDHostBus &bus() { return oledHostBus; }
+
+   // Copy the visible part of the emulated panel GRAM to `frame`, in the
+   // layout of the framebuffer
+   void readPanel(uint8_t *frame)
+   {
+      uint8_t colOffset = 0;
+      if (display_mode == OLEDDISPLAY_DISPLAY_PAGED)
+      {
+         // Same column the paged writer starts at, see addressFlushStep()
+         colOffset = (((0x12 - (uint8_t)OLEDDISPLAY_CHIPSET) & 0x0F) << 4) | (uint8_t)OLEDDISPLAY_CHIPSET;
+      }
+      for (uint8_t page = 0; page < _display_height / 8; page++)
+      {
+         for (uint8_t x = 0; x < _display_width; x++)
+         {
+            frame[page * _display_width + x] = oledHostBus.panel.visibleByte(page, colOffset + x);
+         }
+      }
+   }
+
+   // True if the emulated panel GRAM shows exactly what is in the framebuffer
+   bool panelMatchesBuffer()
+   {
+      uint8_t frame[OLEDHOST_GRAM_PAGES * OLEDHOST_GRAM_COLUMNS];
+      readPanel(frame);
+      return memcmp(frame, buffer, _display_buffer_size) == 0;
+   }
+};
+
+#endif
@@ -0,0 +1,1395 @@
+// Host benchmark for the OLEDDisplay draw primitives.
+//
+// This is not an Arduino sketch, it runs on the build machine against the
+// SSD1306Host backend (OLEDDisplay_Host.h). Build and run from this directory:
+//
+//   g++ -std=gnu++11 -O2 -funsigned-char -I../../host -I../.. HostBenchmark.cpp -o HostBenchmark
+//   ./HostBenchmark
+//
+// (-funsigned-char matches the ARM ABI the fonts are written for.)
+//
+// Every case is rendered once into a cleared framebuffer and the FNV-1a
+// checksum of the buffer is compared against the golden value recorded from
+// the reference implementation, then the case is timed over repeated runs.
+// display() is also checked against the emulated panel GRAM. The exit status
+// is non-zero if anything does not match.
+//
+// Add -DOLEDDISPLAY_DOUBLE_BUFFER or -DOLEDDISPLAY_PAGE_HASH to compare the
+// bytes sent and the flush time of the change detection modes.
+// Add -DOLEDDISPLAY_GLYPH_CACHE=32 to time the glyphs with the glyph cache.
+// Add -DOLEDDISPLAY_CIRCLE_SPAN_CACHE to time circles with the cached span tables.
+
+#include <string>
+#include <utility>
+#include <vector>
+#include <Arduino.h>
+#include "SSD1306Host.h"
+#include "../SquixOLED_Screentest/angry_cookie_64x32_xbm.h"
+#include "angry_cookie_image.h"  // the same bitmap through tools/xbm2image.py
+#include "OLEDDisplayFontsRLE.h"  // the fonts through tools/fontrle.py
+#include "TallFont.h"
+#include "OLEDDisplayFontSubset.h"
+#include "OLEDDisplayUi.h"
+#ifndef OLEDDISPLAY_DISPLAY_LIST
+#include "OLEDDisplayStatic.h"
+#endif
+
+SSD1306Host oled;
+
+struct ScreenSize
+{
+   uint8_t width, height;
+};
+
+const ScreenSize sizes[] = {{64, 32}, {128, 64}};
+#define SIZE_COUNT (sizeof(sizes) / sizeof(sizes[0]))
+
+// Each case draws into the display and returns the number of primitive calls
+typedef uint32_t (*DrawCase)(OLEDDisplay &d, int16_t w, int16_t h);
+
+struct BenchCase
+{
+   const char *name;
+   DrawCase draw;
+   uint32_t golden[SIZE_COUNT];
+};
+
+uint32_t fnv1a(const uint8_t *data, uint32_t length)
+{
+   uint32_t hash = 2166136261u;
+   while (length--)
+   {
+      hash ^= *data++;
+      hash *= 16777619u;
+   }
+   return hash;
+}
+
+uint32_t bufferChecksum() { return fnv1a(oled.buffer, oled.getDisplayWidth() * oled.getDisplayHeight() / 8); }
+
+template <class D>
+uint32_t drawPixels(D &d, int16_t w, int16_t h)
+{
+   uint32_t calls = 0;
+   d.setColor(WHITE);
+   for (int16_t y = -2; y < h + 2; y++)
+   {
+      for (int16_t x = -2; x < w + 2; x++)
+      {
+         if (((x * 7 + y * 13) & 7) < 3)
+         {
+            d.setPixel(x, y);
+            calls++;
+         }
+      }
+   }
+   d.setColor(INVERSE);
+   for (int16_t x = 0; x < w; x += 3)
+   {
+      d.setPixel(x, x % h);
+      calls++;
+   }
+   d.setColor(WHITE);
+   return calls;
+}
+
+template <class D>
+uint32_t drawLines(D &d, int16_t w, int16_t h)
+{
+   uint32_t calls = 0;
+   d.setColor(WHITE);
+   for (int16_t k = 0; k < w; k += 4)
+   {
+      d.drawLine(0, 0, k, h - 1);
+      d.drawLine(w - 1, 0, k, h - 1);
+      calls += 2;
+   }
+   for (int16_t k = 0; k < h; k += 3)
+   {
+      d.drawLine(0, k, w - 1, h - 1 - k);
+      calls++;
+   }
+   d.drawLine(-10, -5, w + 10, h + 5);
+   d.drawLine(w / 2, -20, w / 2 + 3, h + 20);
+   d.drawLine(5, h / 2, w - 5, h / 2);
+   d.drawLine(w / 3, 2, w / 3, h - 2);
+   calls += 4;
+   d.setColor(BLACK);
+   d.drawLine(0, h / 3, w - 1, h / 3 + 2);
+   calls++;
+   d.setColor(WHITE);
+   return calls;
+}
+
+template <class D>
+uint32_t drawRects(D &d, int16_t w, int16_t h)
+{
+   uint32_t calls = 0;
+   d.setColor(WHITE);
+   for (int16_t k = 0; k < w; k += 6)
+   {
+      d.fillRect(k, k / 3, 3 + k / 4, 1 + k % 13);
+      calls++;
+   }
+   d.fillRect(-5, -3, 20, 12);
+   d.fillRect(w - 10, h - 5, 30, 30);
+   d.fillRect(2, 9, w - 4, 14);
+   d.setColor(BLACK);
+   d.fillRect(3, 5, w / 2, h / 3);
+   d.fillRect(w / 2, 17, 9, 4);
+   d.setColor(INVERSE);
+   d.fillRect(w / 4, 2, w / 2, h - 4);
+   d.fillRect(w / 3, 1, 5, 3);
+   d.fillRect(0, 0, w, h);
+   d.setColor(WHITE);
+   d.fillRect(4, 4, 0, 5);
+   d.fillRect(4, 4, 5, -1);
+   calls += 10;
+   return calls;
+}
+
+template <class D>
+uint32_t drawCircles(D &d, int16_t w, int16_t h)
+{
+   uint32_t calls = 0;
+   d.setColor(WHITE);
+   d.fillCircle(w / 2, h / 2, h / 3);
+   d.fillCircle(0, 0, 10);
+   d.fillCircle(w, h, 12);
+   d.fillCircle(w / 4, h / 2, 5);
+   d.fillCircle(3 * w / 4, h / 3, 1);
+   d.setColor(BLACK);
+   d.fillCircle(w / 2, h / 2, h / 6);
+   d.setColor(WHITE);
+   d.drawCircle(w / 2, h / 2, h / 2 - 1);
+   d.drawCircle(w - 8, 8, 6);
+   calls += 8;
+   return calls;
+}
+
+template <class D>
+uint32_t drawRoundRects(D &d, int16_t w, int16_t h)
+{
+   uint32_t calls = 0;
+   d.setColor(WHITE);
+   d.drawRoundRect(1, 1, w - 2, h - 2, 6);
+   d.fillRoundRect(4, 4, w / 2, h / 3, 4);
+   d.fillRoundRect(w / 2, h / 2, w, h, 8);
+   d.drawRoundRect(-3, h - 10, 14, 14, 20);
+   d.setColor(BLACK);
+   d.fillRoundRect(6, 6, w / 4, 4, 1);
+   d.setColor(INVERSE);
+   d.drawRoundRect(w / 4, 2, w / 2, h / 2, 3);
+   d.drawProgressBar(2, h - 12, w - 5, 8, 60);
+   d.drawProgressBar(w / 2, 2, w / 3, 5, 0);
+   calls += 8;
+   return calls;
+}
+
+uint32_t drawXbms(OLEDDisplay &d, int16_t w, int16_t h)
+{
+   uint32_t calls = 0;
+   d.setColor(WHITE);
+   d.drawXbm(0, 0, angry_cookie::width, angry_cookie::height, angry_cookie::bits);
+   d.drawXbm(w - 20, 5, angry_cookie::width, angry_cookie::height, angry_cookie::bits);
+   d.drawXbm(-7, -3, angry_cookie::width, angry_cookie::height, angry_cookie::bits);
+   d.setColor(INVERSE);
+   d.drawXbm(w / 3, h / 2 - 13, angry_cookie::width, angry_cookie::height, angry_cookie::bits);
+   d.setColor(BLACK);
+   d.drawXbm(w / 2 + 1, 3, angry_cookie::width, 16, angry_cookie::bits);
+   d.setColor(WHITE);
+   calls += 5;
+   return calls;
+}
+
+uint32_t drawImages(OLEDDisplay &d, int16_t w, int16_t h)
+{
+   uint32_t calls = 0;
+   d.setColor(WHITE);
+   d.drawFastImage(0, 0, angry_cookie_width, angry_cookie_height, angry_cookie_image);
+   d.drawFastImage(w - 20, 5, angry_cookie_width, angry_cookie_height, angry_cookie_image);
+   d.drawFastImage(-7, -3, angry_cookie_width, angry_cookie_height, angry_cookie_image);
+   d.setColor(INVERSE);
+   d.drawFastImage(w / 3, h / 2 - 13, angry_cookie_width, angry_cookie_height, angry_cookie_image);
+   d.setColor(WHITE);
+   calls += 4;
+   return calls;
+}
+
+uint32_t drawStrings(OLEDDisplay &d, int16_t w, int16_t h)
+{
+   uint32_t calls = 0;
+   d.setColor(WHITE);
+   d.setTextAlignment(TEXT_ALIGN_LEFT);
+   d.setFont(ArialMT_Plain_10);
+   d.drawString(0, 0, "CLOCK");
+   d.drawString(0, 10, "16.10.2026");
+   d.drawString(0, 20, "12:34:56");
+   d.drawString(w - 20, 3, "wrapping off");
+   d.drawString(-9, h - 11, "left\nclip");
+   d.setFont(ArialMT_Plain_16);
+   d.drawString(3, 5, "Hey 42");
+   d.setTextAlignment(TEXT_ALIGN_CENTER);
+   d.drawString(w / 2, h - 14, "abc");
+   d.setTextAlignment(TEXT_ALIGN_RIGHT);
+   d.setFont(ArialMT_Plain_24);
+   d.setColor(INVERSE);
+   d.drawString(w, 8, "07");
+   d.setColor(BLACK);
+   d.setFont(ArialMT_Plain_10);
+   d.setTextAlignment(TEXT_ALIGN_LEFT);
+   d.drawString(1, 16, "||||||||");
+   d.setColor(WHITE);
+   calls += 9;
+   return calls;
+}
+
+// Clock digits on page aligned and unaligned rows, returns glyphs drawn
+uint32_t drawGlyphs(OLEDDisplay &d, int16_t, int16_t h)
+{
+   const char *digits = "12:34:56.7890";
+   uint32_t glyphs = 0;
+   d.setColor(WHITE);
+   d.setTextAlignment(TEXT_ALIGN_LEFT);
+   d.setFont(ArialMT_Plain_10);
+   for (int16_t y = 0; y < h; y += 8)
+   {
+      d.drawString(0, y + (y & 8 ? 3 : 0), digits);
+      glyphs += strlen(digits);
+   }
+   d.setColor(INVERSE);
+   d.setFont(ArialMT_Plain_16);
+   d.drawString(1, 5, "09:41");
+   glyphs += 5;
+   d.setColor(WHITE);
+   return glyphs;
+}
+
+uint32_t drawFrame(OLEDDisplay &d, int16_t w, int16_t h)
+{
+   d.setColor(WHITE);
+   d.setTextAlignment(TEXT_ALIGN_LEFT);
+   d.setFont(ArialMT_Plain_10);
+   d.drawRect(0, 0, w, h);
+   d.drawString(2, 1, "12:34:56");
+   d.fillRect(w / 2, h / 2, w / 3, h / 3);
+   d.drawLine(0, h - 1, w - 1, 0);
+   return 4;
+}
+
+const BenchCase cases[] = {
+    {"setPixel", drawPixels<OLEDDisplay>, {0x3478894a, 0xa6890f6f}},
+    {"drawLine", drawLines<OLEDDisplay>, {0x5d48423d, 0xafdbb952}},
+    {"fillRect", drawRects<OLEDDisplay>, {0x7e77900c, 0x93817f3a}},
+    {"fillCircle", drawCircles<OLEDDisplay>, {0x530dc1cb, 0x89528fdb}},
+    {"roundRect", drawRoundRects<OLEDDisplay>, {0x85098b65, 0xb269be4f}},
+    {"drawXbm", drawXbms, {0x3861cf44, 0xa22ea709}},
+    {"drawFastImage", drawImages, {0xa7469838, 0xa22ea709}},
+    {"drawString", drawStrings, {0x6acfd98f, 0xa47b4e81}},
+    {"glyphs", drawGlyphs, {0xf693688d, 0x888cf4c0}},
+};
+#define CASE_COUNT (sizeof(cases) / sizeof(cases[0]))
+
+// Golden checksums of the frame drawn before timing display()
+const uint32_t displayGolden[SIZE_COUNT] = {0x57fd60ed, 0xc3f21a37};
+
+typedef std::chrono::steady_clock benchClock;
+
+double elapsedNs(benchClock::time_point start)
+{
+   return std::chrono::duration<double, std::nano>(benchClock::now() - start).count();
+}
+
+// Run `body` until at least 50ms have passed, returns ns per run
+template <typename F>
+double timeRuns(F body, uint32_t &runs)
+{
+   runs = 0;
+   uint32_t batch = 1;
+   double total = 0;
+   while (total < 50e6)
+   {
+      benchClock::time_point start = benchClock::now();
+      for (uint32_t i = 0; i < batch; i++) body();
+      total += elapsedNs(start);
+      runs += batch;
+      batch *= 2;
+   }
+   return total / runs;
+}
+
+// The chars src/buttonlessdfu.cpp draws
+typedef OLEDFontSubset<ArialMT_Plain_10, 'C', 'L', 'O', 'K', 'R', 'E', 'I', 'V', 'D', '0', '1', '2', '3',
+                       '4', '5', '6', '7', '8', '9', '.', ':'>
+    WatchFont;
+
+// The watch face from src/buttonlessdfu.cpp, `tick` seconds past 12:34:00
+void drawClock(OLEDDisplay &d, uint32_t tick, const char *font = ArialMT_Plain_10)
+{
+   char text[11];
+   d.setColor(WHITE);
+   d.setTextAlignment(TEXT_ALIGN_LEFT);
+   d.setFont(font);
+   d.drawString(0, 0, "CLOCK");
+   d.drawString(0, 8, "16.10.2026");
+   snprintf(text, sizeof(text), "12:34:%02u", (unsigned)(tick % 60));
+   d.drawString(0, 16, text);
+}
+
+// Only redraw the seconds of the face drawn by drawClock()
+void drawClockSeconds(OLEDDisplay &d, uint32_t tick)
+{
+   char text[3];
+   int16_t x = d.getStringWidth("12:34:");
+   d.setColor(BLACK);
+   d.fillRect(x, 16, d.getStringWidth("00"), 13);
+   d.setColor(WHITE);
+   snprintf(text, sizeof(text), "%02u", (unsigned)(tick % 60));
+   d.drawString(x, 16, text);
+}
+
+volatile uint32_t flushesDone = 0;
+void onFlushDone() { flushesDone++; }
+
+// Flush the current frame with displayAsync(), driving the SPI model until
+// it goes idle like the interrupt would. Returns false on a TXD overrun or
+// a missing callback
+bool flushAsync()
+{
+   uint32_t done = flushesDone;
+   oled.displayAsync(onFlushDone);
+   while (oled.bus().clockByte())
+   {
+   }
+   return !oled.displayBusy() && flushesDone == done + 1 && oled.bus().txdOverruns == 0 &&
+          oled.bus().strayWrites == 0;
+}
+
+// The async flush of a full frame must put the same bytes with the same DC
+// levels on the wire as display()
+bool checkAsyncFrame(const ScreenSize &size)
+{
+   oled.bus().resetCounters();
+   oled.invalidate();
+   oled.display();
+   std::vector<uint16_t> expected = oled.bus().trace;
+
+   oled.bus().resetCounters();
+   oled.invalidate();
+   bool ok = flushAsync() && oled.bus().trace == expected && oled.panelMatchesBuffer();
+   printf("%-13s %3dx%-3d %10u interrupts/frame, %u CS cycles, trace %s\n", "  async", size.width,
+          size.height, oled.bus().interrupts, oled.bus().csAssertions, ok ? "ok" : "MISMATCH");
+   return ok;
+}
+
+// A transmitter that is done with each byte before the core gets to the next
+// instruction raises READY while displayAsync() still loads TXD from thread
+// context. The interrupt has to wait until that first fill is complete
+bool checkAsyncInstant(const ScreenSize &size)
+{
+   oled.bus().resetCounters();
+   oled.invalidate();
+   oled.display();
+   std::vector<uint16_t> expected = oled.bus().trace;
+
+   oled.bus().resetCounters();
+   oled.bus().instantTransfer = true;
+   oled.invalidate();
+   uint32_t done = flushesDone;
+   oled.displayAsync(onFlushDone);
+   oled.bus().instantTransfer = false;
+   bool ok = !oled.displayBusy() && flushesDone == done + 1 && oled.bus().strayWrites == 0 &&
+             oled.bus().trace == expected && oled.panelMatchesBuffer();
+   printf("%-13s %3dx%-3d %10u interrupts/frame, %u CS cycles, trace %s\n", "  async fast", size.width,
+          size.height, oled.bus().interrupts, oled.bus().csAssertions, ok ? "ok" : "MISMATCH");
+   return ok;
+}
+
+// drawString() decodes UTF-8 while drawing, the log buffer stores the text
+// already decoded by write(). Both have to end up with the same pixels
+bool checkUtf8(const ScreenSize &size)
+{
+   const char *text = "Gr\xC3\xBC\xC3\x9F" "e 5\xE2\x82\xAC \xC3\x84 0\xC2\xB0";
+   oled.setColor(WHITE);
+   oled.setFont(ArialMT_Plain_10);
+   oled.setTextAlignment(TEXT_ALIGN_LEFT);
+
+   oled.clear();
+   oled.drawString(2, 1, text);
+   uint32_t drawn = bufferChecksum();
+
+   oled.clear();
+   oled.setLogBuffer(2, 16);
+   oled.print(text);
+   oled.drawLogBuffer(2, 1);
+   bool ok = bufferChecksum() == drawn && oled.getStringWidth(text) == oled.getStringWidth(String(text));
+   printf("%-13s %3dx%-3d %18s   %08x  %s\n", "utf8", size.width, size.height, "", drawn,
+          ok ? "ok" : "MISMATCH");
+   return ok;
+}
+
+// A long notification, wrapped to the screen width and scrolled
+const char *notification =
+    "Meeting moved: the weekly sync is now on Thursday at 14:30 in room 2.17, "
+    "bring the measurements of the new battery pack and the current logs.\n"
+    "Reminder: the firmware freeze for release 1.4 is next Monday. Please "
+    "merge the display driver changes and the step-counter calibration "
+    "before then, everything else moves to 1.5.\n"
+    "Weather: sunny, 21\xC2\xB0 in the afternoon, light wind from the west-south-west, "
+    "no rain expected until the weekend.";
+
+#define WRAP_MAX_LINES 48
+
+// drawStringMaxWidth() lays the text out on every frame, layoutText() once
+// for drawTextLayout(). Both have to draw the same pixels
+bool reportWrap(const ScreenSize &size)
+{
+   uint16_t length = strlen(notification);
+   oled.setColor(WHITE);
+   oled.setFont(ArialMT_Plain_10);
+   oled.setTextAlignment(TEXT_ALIGN_LEFT);
+
+   oled.clear();
+   oled.drawStringMaxWidth(0, 0, size.width, notification, length);
+   uint32_t wrapped = bufferChecksum();
+
+   OLEDTextLine lines[WRAP_MAX_LINES];
+   uint16_t lineCount = oled.layoutText(notification, length, size.width, lines, WRAP_MAX_LINES);
+   oled.clear();
+   oled.drawTextLayout(0, 0, notification, lines, lineCount);
+   bool ok = lineCount <= WRAP_MAX_LINES && bufferChecksum() == wrapped;
+   lineCount = min(lineCount, (uint16_t)WRAP_MAX_LINES);
+
+   uint32_t runs;
+   int16_t scroll = 0;
+   double wrapNs = timeRuns([&]() {
+      oled.drawStringMaxWidth(0, -(scroll++ & 63), size.width, notification, length);
+   }, runs);
+   double layoutNs = timeRuns([&]() {
+      lineCount = oled.layoutText(notification, length, size.width, lines, WRAP_MAX_LINES);
+   }, runs);
+   double cachedNs = timeRuns([&]() {
+      oled.drawTextLayout(0, -(scroll++ & 63), notification, lines, lineCount);
+   }, runs);
+
+   printf("%-13s %3dx%-3d %10.1f ns/char    %u chars, %u lines\n", "layoutText", size.width,
+          size.height, layoutNs / length, length, lineCount);
+   printf("%-13s %3dx%-3d %10.1f ns/frame  %s\n", "  maxWidth", size.width, size.height, wrapNs,
+          ok ? "ok" : "MISMATCH");
+   printf("%-13s %3dx%-3d %10.1f ns/frame\n", "  layout", size.width, size.height, cachedNs);
+   return ok;
+}
+
+struct FontPair
+{
+   const char *name;
+   const char *raw;
+   const char *rle;
+   uint16_t rawSize, rleSize;
+};
+
+const FontPair fontPairs[] = {
+    {"ArialMT 10", ArialMT_Plain_10, ArialMT_Plain_10_RLE, sizeof(ArialMT_Plain_10), sizeof(ArialMT_Plain_10_RLE)},
+    {"ArialMT 16", ArialMT_Plain_16, ArialMT_Plain_16_RLE, sizeof(ArialMT_Plain_16), sizeof(ArialMT_Plain_16_RLE)},
+    {"ArialMT 24", ArialMT_Plain_24, ArialMT_Plain_24_RLE, sizeof(ArialMT_Plain_24), sizeof(ArialMT_Plain_24_RLE)},
+};
+
+// All 224 glyphs of a font in rows of 32 (UTF-8 encoded), shifted against
+// the pages and cut off by the screen edges, returns glyphs drawn
+uint32_t drawFontSheet(OLEDDisplay &d, const char *font, int16_t h)
+{
+   char text[64];
+   d.setFont(font);
+   d.setTextAlignment(TEXT_ALIGN_LEFT);
+   for (uint16_t row = 0; row < 7; row++)
+   {
+      char *c = text;
+      for (uint16_t code = 32 + row * 32; code < 64 + row * 32; code++)
+      {
+         if (code >= 0xC0)
+         {
+            *c++ = 0xC3;
+            *c++ = 0x80 | (code & 0x3F);
+         }
+         else
+         {
+            if (code >= 0x80) *c++ = 0xC2;
+            *c++ = code;
+         }
+      }
+      d.setColor(row & 1 ? INVERSE : WHITE);
+      d.drawString(-3 * (int16_t)row, row * h / 7 - 3, text, c - text);
+   }
+   d.setColor(WHITE);
+   return 7 * 32;
+}
+
+// The run length encoded fonts must draw the same pixels as the originals
+bool reportRleFonts(const ScreenSize &size)
+{
+   bool ok = true;
+   for (uint8_t f = 0; f < sizeof(fontPairs) / sizeof(fontPairs[0]); f++)
+   {
+      const FontPair &pair = fontPairs[f];
+      double ns[2];
+      uint32_t checksum[2];
+      for (uint8_t rle = 0; rle < 2; rle++)
+      {
+         const char *font = rle ? pair.rle : pair.raw;
+         oled.clear();
+         uint32_t glyphs = drawFontSheet(oled, font, size.height);
+         checksum[rle]   = bufferChecksum();
+         uint32_t runs;
+         ns[rle] = timeRuns([&]() { drawFontSheet(oled, font, size.height); }, runs) / glyphs;
+      }
+      bool same = checksum[0] == checksum[1];
+      printf("%-13s %3dx%-3d %10.1f ns/glyph, RLE %5.1f ns/glyph, %5u -> %4u bytes  %s\n", pair.name,
+             size.width, size.height, ns[0], ns[1], pair.rawSize, pair.rleSize, same ? "ok" : "MISMATCH");
+      ok &= same;
+   }
+
+   // Glyphs taller than the screen, cut at the top and the bottom
+   bool tallOk = true;
+   for (int16_t y = -50; y <= 10; y += 15)
+   {
+      uint32_t checksum[2];
+      for (uint8_t rle = 0; rle < 2; rle++)
+      {
+         oled.clear();
+         oled.setFont(rle ? TallDigits_RLE : TallDigits);
+         oled.drawString(-2, y, "0123:456789");
+         oled.setColor(INVERSE);
+         oled.drawString(3, y + 5, "98:76");
+         oled.setColor(WHITE);
+         checksum[rle] = bufferChecksum();
+      }
+      oled.clear();
+      tallOk &= checksum[0] == checksum[1] && checksum[0] != bufferChecksum();
+   }
+   printf("%-13s %3dx%-3d %18s   %u rows  %s\n", "TallDigits", size.width, size.height, "",
+          pgm_read_byte(TallDigits + HEIGHT_POS), tallOk ? "ok" : "MISMATCH");
+   ok &= tallOk;
+   oled.setFont(ArialMT_Plain_10);
+   return ok;
+}
+
+// Text drawn at `scale` at (x, y) must have the pixel (x / scale, y / scale)
+// of the same text drawn unscaled at (0, 0) at every (x, y) on screen
+bool checkScaledText(const ScreenSize &size, const char *font, uint8_t scale, int16_t x, int16_t y,
+                     OLEDDISPLAY_COLOR color)
+{
+   const char *text = "12:34 Ag";
+   std::vector<bool> reference(size.width * size.height);
+   oled.setFont(font);
+   oled.setColor(WHITE);
+   oled.clear();
+   oled.drawString(0, 0, text);
+   for (int16_t py = 0; py < size.height; py++)
+      for (int16_t px = 0; px < size.width; px++)
+         reference[py * size.width + px] = oled.buffer[px + (py >> 3) * size.width] >> (py & 7) & 1;
+   uint16_t width = oled.getStringWidth(text);
+
+   oled.clear();
+   if (color == BLACK) oled.fillRect(0, 0, size.width, size.height);
+   oled.setColor(color);
+   oled.setFontScale(scale);
+   oled.drawString(x, y, text);
+   bool ok = oled.getStringWidth(text) == width * scale;
+   oled.setFontScale(1);
+   oled.setColor(WHITE);
+   for (int16_t py = 0; py < size.height; py++)
+   {
+      for (int16_t px = 0; px < size.width; px++)
+      {
+         bool inked = px >= x && py >= y && reference[(py - y) / scale * size.width + (px - x) / scale];
+         bool pixel = oled.buffer[px + (py >> 3) * size.width] >> (py & 7) & 1;
+         ok &= pixel == (color == BLACK ? !inked : inked);
+      }
+   }
+   return ok;
+}
+
+// Scaled text against the reference, then a clock drawn in a 10 or 16 px
+// font at 2x or 3x timed against the native 24 px font, at every row
+// offset against the pages
+bool reportScaledFonts(const ScreenSize &size)
+{
+   const int16_t offsets[][2] = {{0, 0}, {-5, 3}, {7, -6}};
+   bool ok                    = true;
+   for (uint8_t scale = 2; scale <= 3; scale++)
+   {
+      for (uint8_t o = 0; o < 3; o++)
+      {
+         ok &= checkScaledText(size, ArialMT_Plain_10, scale, offsets[o][0], offsets[o][1], WHITE);
+         ok &= checkScaledText(size, ArialMT_Plain_10_RLE, scale, offsets[o][0], offsets[o][1], INVERSE);
+         ok &= checkScaledText(size, ArialMT_Plain_16, 2, offsets[o][0], offsets[o][1], BLACK);
+      }
+   }
+   // Taller than the screen at 3x (84 rows), cut at the top and the bottom
+   for (int16_t y = -45; y <= 5; y += 25)
+   {
+      ok &= checkScaledText(size, ArialMT_Plain_24, 3, -2, y, WHITE);
+      ok &= checkScaledText(size, ArialMT_Plain_24_RLE, 3, 1, y + 1, INVERSE);
+   }
+
+   const char *clock = "12:34";
+   struct
+   {
+      const char *font;
+      uint8_t scale;
+      double ns;
+   } faces[] = {{ArialMT_Plain_24, 1, 0}, {ArialMT_Plain_10, 2, 0}, {ArialMT_Plain_10, 3, 0}, {ArialMT_Plain_16, 2, 0}};
+   for (auto &face : faces)
+   {
+      oled.setFont(face.font);
+      oled.setFontScale(face.scale);
+      uint32_t runs;
+      face.ns = timeRuns([&]() {
+                   for (int16_t y = 0; y < 8; y++) oled.drawString(0, y, clock);
+                }, runs) / (8 * strlen(clock));
+   }
+   oled.setFontScale(1);
+   oled.setFont(ArialMT_Plain_10);
+   printf("%-13s %3dx%-3d %10.1f ns/glyph (24 px), 10 px x2 %.1f, x3 %.1f, 16 px x2 %.1f  %s\n", "scaledFont",
+          size.width, size.height, faces[0].ns, faces[1].ns, faces[2].ns, faces[3].ns, ok ? "ok" : "MISMATCH");
+   return ok;
+}
+
+// The subset has to draw and measure the watch face like the full font
+bool checkFontSubset(const ScreenSize &size)
+{
+   uint32_t checksum[2];
+   uint16_t width[2];
+   for (uint8_t subset = 0; subset < 2; subset++)
+   {
+      oled.clear();
+      drawClock(oled, 56, subset ? WatchFont::data : ArialMT_Plain_10);
+      checksum[subset] = bufferChecksum();
+      width[subset]    = oled.getStringWidth("12:34:56.RECEIVED");
+   }
+   bool same = checksum[0] == checksum[1] && width[0] == width[1];
+   printf("%-13s %3dx%-3d %10u chars, %5u -> %4u bytes  %s\n", "fontSubset", size.width, size.height,
+          WatchFont::charNum, (unsigned)sizeof(ArialMT_Plain_10), WatchFont::size, same ? "ok" : "MISMATCH");
+   oled.setFont(ArialMT_Plain_10);
+   return same;
+}
+
+// The circles as they were drawn pixel by pixel (and row by row) before the
+// span tables
+void pixelCircle(OLEDDisplay &d, int16_t x0, int16_t y0, int16_t radius)
+{
+   int16_t x = 0, y = radius;
+   int16_t dp = 1 - radius;
+   do
+   {
+      if (dp < 0)
+         dp = dp + 2 * (++x) + 3;
+      else
+         dp = dp + 2 * (++x) - 2 * (--y) + 5;
+      d.setPixel(x0 + x, y0 + y);
+      d.setPixel(x0 - x, y0 + y);
+      d.setPixel(x0 + x, y0 - y);
+      d.setPixel(x0 - x, y0 - y);
+      d.setPixel(x0 + y, y0 + x);
+      d.setPixel(x0 - y, y0 + x);
+      d.setPixel(x0 + y, y0 - x);
+      d.setPixel(x0 - y, y0 - x);
+   } while (x < y);
+   d.setPixel(x0 + radius, y0);
+   d.setPixel(x0, y0 + radius);
+   d.setPixel(x0 - radius, y0);
+   d.setPixel(x0, y0 - radius);
+}
+
+void pixelCircleQuads(OLEDDisplay &d, int16_t x0, int16_t y0, int16_t radius, uint8_t quads)
+{
+   int16_t x = 0, y = radius;
+   int16_t dp = 1 - radius;
+   while (x < y)
+   {
+      if (dp < 0)
+         dp = dp + 2 * (++x) + 3;
+      else
+         dp = dp + 2 * (++x) - 2 * (--y) + 5;
+      if (quads & 0x1) d.setPixel(x0 + x, y0 - y), d.setPixel(x0 + y, y0 - x);
+      if (quads & 0x2) d.setPixel(x0 - y, y0 - x), d.setPixel(x0 - x, y0 - y);
+      if (quads & 0x4) d.setPixel(x0 - y, y0 + x), d.setPixel(x0 - x, y0 + y);
+      if (quads & 0x8) d.setPixel(x0 + x, y0 + y), d.setPixel(x0 + y, y0 + x);
+   }
+   if (quads & 0x1 && quads & 0x8) d.setPixel(x0 + radius, y0);
+   if (quads & 0x4 && quads & 0x8) d.setPixel(x0, y0 + radius);
+   if (quads & 0x2 && quads & 0x4) d.setPixel(x0 - radius, y0);
+   if (quads & 0x1 && quads & 0x2) d.setPixel(x0, y0 - radius);
+}
+
+void rowFillCircle(OLEDDisplay &d, int16_t x0, int16_t y0, int16_t radius)
+{
+   int16_t x = 0, y = radius;
+   int16_t dp = 1 - radius;
+   do
+   {
+      if (dp < 0)
+         dp = dp + 2 * (++x) + 3;
+      else
+         dp = dp + 2 * (++x) - 2 * (--y) + 5;
+      d.drawHorizontalLine(x0 - x, y0 - y, 2 * x);
+      d.drawHorizontalLine(x0 - x, y0 + y, 2 * x);
+      d.drawHorizontalLine(x0 - y, y0 - x, 2 * y);
+      d.drawHorizontalLine(x0 - y, y0 + x, 2 * y);
+   } while (x < y);
+   d.drawHorizontalLine(x0 - radius, y0, 2 * radius);
+}
+
+// The log console against a plain string with the same rules: at most
+// `lines` line breaks and `lines * chars` chars, the oldest line goes first
+// (or the oldest char of a single line). Drawn at a few points of a long
+// stream, the lines below the screen and lines across the ring end included
+bool checkLogBuffer(const ScreenSize &size)
+{
+   const uint16_t lines = 4, chars = 12;
+   std::string model;
+   bool ok = oled.setLogBuffer(lines, chars);
+   uint16_t bytes = size.width * size.height / 8;
+   uint8_t expected[128 * 64 / 8];
+   uint32_t seed = 7;
+   for (uint16_t i = 0; i < 2000 && ok; i++)
+   {
+      seed = seed * 1103515245 + 12345;
+      uint8_t pick = (seed >> 16) % 16;
+      char c = pick < 3 ? '\n' : pick == 3 ? '\r' : (char)('A' + (seed >> 8) % 26);
+      if (i % 400 > 300 && c == '\n') c = 'x';  // lines longer than the buffer
+      oled.write((uint8_t)c);
+      if (c != '\r')
+      {
+         uint16_t breaks = 0;
+         for (char m : model) breaks += m == '\n';
+         if (breaks == lines) model.erase(0, model.find('\n') + 1);
+         if (model.size() == lines * chars)
+            model.erase(0, model.find('\n') == std::string::npos ? 1 : model.find('\n') + 1);
+         model += c;
+      }
+      if (i % 37) continue;
+
+      int16_t y = i % 2 ? 0 : size.height - 25;
+      oled.clear();
+      oled.setTextAlignment(TEXT_ALIGN_LEFT);
+      size_t from = 0;
+      for (int16_t line = 0;; line++)
+      {
+         size_t end = model.find('\n', from);
+         std::string text = model.substr(from, end == std::string::npos ? end : end - from);
+         oled.drawString(1, y + line * ArialMT_Plain_10[HEIGHT_POS], text.c_str());
+         if (end == std::string::npos) break;
+         from = end + 1;
+      }
+      memcpy(expected, oled.buffer, bytes);
+      oled.clear();
+      oled.drawLogBuffer(1, y);
+      ok &= memcmp(expected, oled.buffer, bytes) == 0;
+   }
+
+   // A full console: every println() drops the oldest line
+   uint32_t runs;
+   const char *text = "12:34:56 RX 42 bytes";
+   double appendNs = timeRuns([&]() { oled.println(text); }, runs) / (strlen(text) + 1);
+   double drawNs   = timeRuns([&]() { oled.drawLogBuffer(0, 0); }, runs);
+   printf("%-13s %3dx%-3d %10.1f ns/char, %.1f ns/draw  %s\n", "logBuffer", size.width, size.height, appendNs,
+          drawNs, ok ? "ok" : "MISMATCH");
+   oled.setLogBuffer(0, 0);
+   return ok;
+}
+
+// Bresenham as drawLine() did it before clipping up front, a pixel at a time
+void pixelLine(OLEDDisplay &d, int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+   bool steep = abs(y1 - y0) > abs(x1 - x0);
+   if (steep) std::swap(x0, y0), std::swap(x1, y1);
+   if (x0 > x1) std::swap(x0, x1), std::swap(y0, y1);
+   int32_t dx = x1 - x0, dy = abs(y1 - y0);
+   int32_t err = dx / 2, ystep = y0 < y1 ? 1 : -1;
+   for (; x0 <= x1; x0++)
+   {
+      steep ? d.setPixel(y0, x0) : d.setPixel(x0, y0);
+      err -= dy;
+      if (err < 0) y0 += ystep, err += dx;
+   }
+}
+
+// Random lines inside, across and outside the screen (in every color) have
+// to set the pixels they did before, then both are timed on the hands of an
+// analogue watch
+bool checkLines(const ScreenSize &size)
+{
+   int16_t w = size.width, h = size.height;
+   uint16_t bytes = w * h / 8;
+   uint8_t expected[128 * 64 / 8];
+   uint32_t seed = 1;
+   auto random = [&](int16_t low, int16_t high) {
+      seed = seed * 1103515245 + 12345;
+      return (int16_t)(low + (seed >> 8) % (high - low + 1));
+   };
+   bool ok = true;
+   for (uint16_t i = 0; i < 3000; i++)
+   {
+      int16_t range = i % 3 == 0 ? 2000 : 2 * w;
+      int16_t x0 = random(-range, w + range), y0 = random(-range, h + range);
+      int16_t x1 = random(-range, w + range), y1 = random(-range, h + range);
+      if (i % 5 == 0) y1 = y0;
+      if (i % 7 == 0) x1 = x0;
+      for (uint8_t pass = 0; pass < 2; pass++)
+      {
+         oled.clear();
+         memset(oled.buffer, 0x5A, bytes);
+         oled.setColor((OLEDDISPLAY_COLOR)(i % 3));
+         pass ? oled.drawLine(x0, y0, x1, y1) : pixelLine(oled, x0, y0, x1, y1);
+         if (!pass) memcpy(expected, oled.buffer, bytes);
+      }
+      ok &= memcmp(expected, oled.buffer, bytes) == 0;
+   }
+
+   oled.clear();
+   oled.setColor(WHITE);
+   auto hands = [&](bool pixels) {
+      const int16_t tips[][2] = {{0, -1}, {5, -3}, {10, 0}, {6, 6}, {-2, 8}, {-9, 4}, {-7, -7}};
+      for (uint8_t t = 0; t < 7; t++)
+      {
+         int16_t x1 = w / 2 + tips[t][0] * h / 20, y1 = h / 2 + tips[t][1] * h / 20;
+         pixels ? pixelLine(oled, w / 2, h / 2, x1, y1) : oled.drawLine(w / 2, h / 2, x1, y1);
+      }
+   };
+   uint32_t runs;
+   double runsNs   = timeRuns([&]() { hands(false); }, runs) / 7;
+   double pixelsNs = timeRuns([&]() { hands(true); }, runs) / 7;
+   printf("%-13s %3dx%-3d %10.1f ns/hand (pixel by pixel %.1f)  %s\n", "lineRuns", w, h, runsNs, pixelsNs,
+          ok ? "ok" : "MISMATCH");
+   oled.setColor(WHITE);
+   return ok;
+}
+
+// Every radius up to past OLEDDISPLAY_CIRCLE_SPAN_RADIUS, whole and clipped,
+// in WHITE and BLACK has to set the pixels it did before, then both ways
+// are timed on a circle of a third of the screen height
+bool checkCircleSpans(const ScreenSize &size)
+{
+   int16_t w = size.width, h = size.height;
+   const int centres[][2] = {{w / 2, h / 2}, {3, h - 2}, {w - 1, -4}};
+   uint16_t bytes = w * h / 8;
+   uint8_t expected[128 * 64 / 8];
+   bool ok = true;
+   for (int16_t radius = 0; radius <= OLEDDISPLAY_CIRCLE_SPAN_RADIUS + 4; radius++)
+   {
+      for (uint8_t c = 0; c < 3; c++)
+      {
+         int16_t x0 = centres[c][0], y0 = centres[c][1];
+         for (uint8_t shape = 0; shape < 18; shape++)
+         {
+            for (uint8_t black = 0; black < 2; black++)
+            {
+               for (uint8_t pass = 0; pass < 2; pass++)
+               {
+                  oled.clear();
+                  if (black) memset(oled.buffer, 0xFF, bytes);
+                  oled.setColor(black ? BLACK : WHITE);
+                  if (shape < 16)
+                     pass ? oled.drawCircleQuads(x0, y0, radius, shape)
+                          : pixelCircleQuads(oled, x0, y0, radius, shape);
+                  else if (shape == 16)
+                     pass ? oled.drawCircle(x0, y0, radius) : pixelCircle(oled, x0, y0, radius);
+                  else
+                     pass ? oled.fillCircle(x0, y0, radius) : rowFillCircle(oled, x0, y0, radius);
+                  if (!pass) memcpy(expected, oled.buffer, bytes);
+               }
+               ok &= memcmp(expected, oled.buffer, bytes) == 0;
+            }
+         }
+      }
+   }
+
+   oled.clear();
+   oled.setColor(WHITE);
+   int16_t radius = h / 3;
+   uint32_t runs;
+   double fill       = timeRuns([&]() { oled.fillCircle(w / 2, h / 2, radius); }, runs);
+   double rowFill    = timeRuns([&]() { rowFillCircle(oled, w / 2, h / 2, radius); }, runs);
+   double outline    = timeRuns([&]() { oled.drawCircle(w / 2, h / 2, radius); }, runs);
+   double pixelOut   = timeRuns([&]() { pixelCircle(oled, w / 2, h / 2, radius); }, runs);
+   double progress   = timeRuns([&]() { oled.drawProgressBar(2, h - 12, w - 5, 8, 60); }, runs);
+   printf("%-13s %3dx%-3d %10.1f ns/fill, %.1f ns/outline (by rows and pixels %.1f, %.1f), "
+          "%.1f ns/progress bar  %s\n",
+          "circleSpans", w, h, fill, outline, rowFill, pixelOut, progress, ok ? "ok" : "MISMATCH");
+   oled.setColor(WHITE);
+   return ok;
+}
+
+// Where the OLEDDisplayUi frames were last drawn, and at which tick
+struct UiFrameCall
+{
+   int16_t x, y;
+   uint16_t tick;
+};
+UiFrameCall uiCalls[2];
+
+void uiTextFrame(OLEDDisplay *d, OLEDDisplayUiState *state, int16_t x, int16_t y)
+{
+   uiCalls[0] = {x, y, state->ticksSinceLastStateSwitch};
+   d->setFont(ArialMT_Plain_10);
+   d->drawString(x, y, "CLOCK");
+   d->drawString(x, y + 8, "16.10.2026");
+   d->drawString(x, y + 16, "12:34:56");
+}
+
+void uiShapeFrame(OLEDDisplay *d, OLEDDisplayUiState *state, int16_t x, int16_t y)
+{
+   uiCalls[1] = {x, y, state->ticksSinceLastStateSwitch};
+   int16_t w = d->getDisplayWidth(), h = d->getDisplayHeight();
+   d->drawXbm(x + w - angry_cookie::width, y, angry_cookie::width, angry_cookie::height, angry_cookie::bits);
+   d->drawCircle(x + w / 4, y + h / 2, h / 4);
+   d->fillRect(x + 2, y + 2, 6, 4);
+}
+
+// Tick `ui` now. A last update of 0 is long enough ago (once millis() is
+// past the update interval) and skips nothing
+void uiTick(OLEDDisplayUi &ui)
+{
+   while (millis() <= 33) delay(1);
+   ui.getUiState()->lastUpdate = 0;
+   ui.update();
+}
+
+// The easing curves have to start at 0, end at 65536 and stay in between
+// (EASE_IN_OUT never goes back), linear transitions have to slide the frames
+// where the float code did, give or take a pixel. With transition buffers
+// every tick has to draw what calling the frames draws. Then ticks are timed
+// with a transition running all the time
+bool checkUi(const ScreenSize &size)
+{
+   bool ok = true;
+   for (uint8_t e = EASE_LINEAR; e <= EASE_BOUNCE; e++)
+   {
+      AnimationEasing easing = (AnimationEasing)e;
+      ok &= animationEase(easing, 0) == 0 && animationEase(easing, 65536) == 65536;
+      uint32_t last = 0;
+      for (uint32_t progress = 0; progress <= 65536; progress += 7)
+      {
+         uint32_t position = animationEase(easing, progress);
+         ok &= position <= 65536;
+         if (easing == EASE_LINEAR) ok &= position == progress;
+         if (easing == EASE_IN_OUT) ok &= position >= last;
+         last = position;
+      }
+   }
+
+   const FrameCallback frames[] = {uiTextFrame, uiShapeFrame};
+   const uint16_t transitionTicks[] = {15, 8, 30, 51};
+   int16_t w = size.width, h = size.height;
+   uint16_t exact = 0, checked = 0;
+   oled.bus().recordTrace = false;
+   for (uint8_t t = 0; t < 4; t++)
+   {
+      for (uint8_t dir = SLIDE_UP; dir <= SLIDE_RIGHT; dir++)
+      {
+         OLEDDisplayUi ui(&oled);
+         ui.setFrames((FrameCallback *)frames, 2);
+         ui.setFrameAnimation((AnimationDirection)dir);
+         ui.setTimePerFrame(0);
+         ui.setTimePerTransition(transitionTicks[t] * 33);
+         // The first tick starts the transition to the shape frame, the
+         // text frame is the current one until it ends
+         for (uint16_t i = 0; i <= transitionTicks[t]; i++)
+         {
+            uiTick(ui);
+            if (ui.getUiState()->frameState != IN_TRANSITION) continue;
+            float progress = (float)uiCalls[0].tick / transitionTicks[t];
+            int16_t x = dir == SLIDE_LEFT ? -w * progress : dir == SLIDE_RIGHT ? w * progress : 0;
+            int16_t y = dir == SLIDE_UP ? -h * progress : dir == SLIDE_DOWN ? h * progress : 0;
+            ok &= abs(uiCalls[0].x - x) <= 1 && abs(uiCalls[0].y - y) <= 1;
+            exact += uiCalls[0].x == x && uiCalls[0].y == y;
+            checked++;
+         }
+      }
+   }
+
+   // Both directions of every slide, eased so the offsets hit every shift
+   uint16_t bytes = w * h / 8;
+   uint8_t expected[128 * 64 / 8];
+   bool buffersOk = true;
+   for (uint8_t dir = SLIDE_UP; dir <= SLIDE_RIGHT; dir++)
+   {
+      for (uint8_t backwards = 0; backwards < 2; backwards++)
+      {
+         OLEDDisplayUi called(&oled), buffered(&oled);
+         OLEDDisplayUi *uis[] = {&called, &buffered};
+         for (OLEDDisplayUi *ui : uis)
+         {
+            ui->setFrames((FrameCallback *)frames, 2);
+            ui->setFrameAnimation((AnimationDirection)dir);
+            ui->setFrameEasing(EASE_BOUNCE);
+            ui->setTimePerFrame(0);
+            ui->setTimePerTransition(40 * 33);
+            if (backwards) ui->setAutoTransitionBackwards();
+         }
+         ok &= buffered.enableTransitionBuffers();
+         for (uint16_t i = 0; i < 90; i++)
+         {
+            uiTick(called);
+            memcpy(expected, oled.buffer, bytes);
+            uiTick(buffered);
+            buffersOk &= memcmp(expected, oled.buffer, bytes) == 0 && oled.panelMatchesBuffer();
+         }
+      }
+   }
+   ok &= buffersOk;
+
+   double ns[3];
+   for (uint8_t e = EASE_LINEAR; e <= EASE_BOUNCE; e++)
+   {
+      OLEDDisplayUi ui(&oled);
+      ui.setFrames((FrameCallback *)frames, 2);
+      ui.setTimePerFrame(0);
+      ui.setFrameEasing((AnimationEasing)e);
+      uint32_t runs;
+      ns[e] = timeRuns([&]() { uiTick(ui); }, runs);
+   }
+   OLEDDisplayUi buffered(&oled);
+   buffered.setFrames((FrameCallback *)frames, 2);
+   buffered.setTimePerFrame(0);
+   buffered.enableTransitionBuffers();
+   uint32_t runs;
+   double bufferedNs = timeRuns([&]() { uiTick(buffered); }, runs);
+   oled.bus().recordTrace = true;
+   printf("%-13s %3dx%-3d %10.0f ticks/s (in-out %.0f, bounce %.0f), %u/%u offsets as float  %s\n", "uiTicks",
+          w, h, 1e9 / ns[EASE_LINEAR], 1e9 / ns[EASE_IN_OUT], 1e9 / ns[EASE_BOUNCE], exact, checked,
+          ok ? "ok" : "MISMATCH");
+   printf("%-13s %3dx%-3d %10.0f ticks/s with transition buffers  %s\n", "", w, h, 1e9 / bufferedNs,
+          buffersOk ? "ok" : "MISMATCH");
+   oled.setTextAlignment(TEXT_ALIGN_LEFT);
+   oled.setColor(WHITE);
+   return ok;
+}
+
+// Vertical slides through the panel start line have to show on the panel
+// what the software slide shows, tick by tick, as long as the frames are
+// still (no indicator here, it doesn't slide). Displays higher than 32 rows
+// fall back to the software slide. Counts the bytes sent per transition tick
+bool checkPanelScroll(const ScreenSize &size)
+{
+   const FrameCallback frames[] = {uiTextFrame, uiShapeFrame};
+   const uint16_t ticks = 2 * 13 + 1;  // two transitions of 12 ticks
+   int16_t w = size.width, h = size.height;
+   uint16_t bytes = w * h / 8;
+   uint8_t frame[128 * 64 / 8];
+   std::vector<uint8_t> expected(ticks * bytes);
+   uint32_t sent[2] = {0, 0}, transitionTicks = 0;
+   bool ok = true;
+   oled.bus().recordTrace = false;
+   for (uint8_t dir = SLIDE_UP; dir <= SLIDE_DOWN; dir++)
+   {
+      for (uint8_t backwards = 0; backwards < 2; backwards++)
+      {
+         for (uint8_t scroll = 0; scroll < 2; scroll++)
+         {
+            OLEDDisplayUi ui(&oled);
+            ui.setFrames((FrameCallback *)frames, 2);
+            ui.setFrameAnimation((AnimationDirection)dir);
+            ui.setFrameEasing(EASE_IN_OUT);
+            ui.setTimePerFrame(0);
+            ui.setTimePerTransition(12 * 33);
+            ui.disableAllIndicators();
+            if (backwards) ui.setAutoTransitionBackwards();
+            if (scroll) ui.enablePanelScroll();
+            for (uint16_t i = 0; i < ticks; i++)
+            {
+               uint32_t before = oled.bus().commandBytes + oled.bus().dataBytes;
+               uiTick(ui);
+               bool transition = ui.getUiState()->frameState == IN_TRANSITION;
+               sent[scroll] += transition ? oled.bus().commandBytes + oled.bus().dataBytes - before : 0;
+               transitionTicks += transition && scroll;
+               if (!scroll)
+               {
+                  memcpy(&expected[i * bytes], oled.buffer, bytes);
+                  continue;
+               }
+               oled.readPanel(frame);
+               ok &= memcmp(frame, &expected[i * bytes], bytes) == 0;
+            }
+         }
+      }
+   }
+   oled.bus().recordTrace = true;
+   printf("%-13s %3dx%-3d %10.1f bytes/tick (software slide %.1f)  %s\n", "panelScroll", w, h,
+          (double)sent[1] / transitionTicks, (double)sent[0] / transitionTicks, ok ? "ok" : "MISMATCH");
+   oled.setTextAlignment(TEXT_ALIGN_LEFT);
+   oled.setColor(WHITE);
+   return ok;
+}
+
+#ifdef OLEDDISPLAY_DISPLAY_LIST
+// Golden checksum of the frame drawClock(56) draws
+const uint32_t clockGolden[SIZE_COUNT] = {0x30825e3d, 0xa20a663d};
+
+uint32_t panelChecksum()
+{
+   uint8_t frame[OLEDHOST_GRAM_PAGES * OLEDHOST_GRAM_COLUMNS];
+   oled.readPanel(frame);
+   return fnv1a(frame, oled.getDisplayWidth() * oled.getDisplayHeight() / 8);
+}
+
+// Every case drawn into the display list has to reach the panel as the
+// framebuffer goldens, timed as whole frames (clear, draw, display())
+template <typename F>
+bool reportDisplayListFrame(const char *name, const ScreenSize &size, uint32_t golden, F draw)
+{
+   oled.clear();
+   draw();
+   oled.display();
+   uint32_t checksum = panelChecksum();
+   uint16_t length   = oled.getDisplayListLength();
+   bool ok           = checksum == golden && !oled.displayListFull();
+
+   uint32_t runs;
+   double ns = timeRuns([&]() {
+      oled.clear();
+      draw();
+      oled.display();
+   }, runs);
+   printf("%-13s %3dx%-3d %10.1f ns/frame  %5u list bytes%s   %08x  %s\n", name, size.width,
+          size.height, ns, length, oled.displayListFull() ? " (full)" : "", checksum,
+          ok ? "ok" : "MISMATCH");
+   return ok;
+}
+
+bool reportDisplayList(const ScreenSize &size, uint8_t s)
+{
+   bool ok = true;
+   printf("%-13s %3dx%-3d %10u bytes of RAM for the page, %u for the framebuffer\n", "", size.width,
+          size.height, size.width, size.width * size.height / 8);
+   for (uint8_t c = 0; c < CASE_COUNT; c++)
+   {
+      const BenchCase &bench = cases[c];
+      ok &= reportDisplayListFrame(bench.name, size, bench.golden[s],
+                                   [&]() { bench.draw(oled, size.width, size.height); });
+   }
+   ok &= reportDisplayListFrame("display()", size, displayGolden[s],
+                                [&]() { drawFrame(oled, size.width, size.height); });
+   ok &= reportDisplayListFrame("  clock", size, clockGolden[s], [&]() { drawClock(oled, 56); });
+   ok &= reportDisplayListFrame("  clock sub", size, clockGolden[s],
+                                [&]() { drawClock(oled, 56, WatchFont::data); });
+   return ok;
+}
+#endif
+
+bool report(const char *name, const ScreenSize &size, double nsPerCall, uint32_t checksum, uint32_t golden)
+{
+   bool ok = checksum == golden;
+   printf("%-13s %3dx%-3d %10.1f ns/call   %08x  %s\n", name, size.width, size.height, nsPerCall,
+          checksum, ok ? "ok" : "MISMATCH");
+   return ok;
+}
+
+#ifndef OLEDDISPLAY_DISPLAY_LIST
+// The same panel with the size fixed at compile time
+OLEDDisplayStatic<SSD1306Host, 64, 32> oled64;
+OLEDDisplayStatic<SSD1306Host, 128, 64> oled128;
+
+const BenchCase &benchCase(DrawCase draw)
+{
+   uint8_t c = 0;
+   while (cases[c].draw != draw) c++;
+   return cases[c];
+}
+
+template <class D, typename F>
+bool reportStatic(D &d, const ScreenSize &size, uint8_t s, DrawCase runtime, F draw)
+{
+   const BenchCase &bench = benchCase(runtime);
+   d.clear();
+   uint32_t calls    = draw();
+   uint32_t checksum = fnv1a(d.buffer, size.width * size.height / 8);
+
+   uint32_t runs;
+   double ns = timeRuns(draw, runs);
+   char name[16];
+   snprintf(name, sizeof(name), "  %s", bench.name);
+   return report(name, size, ns / calls, checksum, bench.golden[s]);
+}
+
+// The primitives called on an OLEDDisplayStatic, checked against the goldens
+// of the run time sized display
+template <class D>
+bool reportStaticDisplay(D &d, const ScreenSize &size, uint8_t s)
+{
+   bool ok = true;
+   d.init();
+   printf("%-13s %3dx%-3d %10u bytes in the display object, nothing allocated\n", "static", size.width,
+          size.height, (unsigned)sizeof(d));
+   ok &= reportStatic(d, size, s, drawPixels<OLEDDisplay>, [&]() { return drawPixels(d, size.width, size.height); });
+   ok &= reportStatic(d, size, s, drawLines<OLEDDisplay>, [&]() { return drawLines(d, size.width, size.height); });
+   ok &= reportStatic(d, size, s, drawRects<OLEDDisplay>, [&]() { return drawRects(d, size.width, size.height); });
+   ok &= reportStatic(d, size, s, drawCircles<OLEDDisplay>, [&]() { return drawCircles(d, size.width, size.height); });
+   ok &= reportStatic(d, size, s, drawRoundRects<OLEDDisplay>,
+                      [&]() { return drawRoundRects(d, size.width, size.height); });
+   d.end();
+   return ok;
+}
+#endif
+
+// Time `frame` with tracing off, print the bus traffic it causes per frame
+// and check that the panel ends up showing the framebuffer
+template <typename F>
+bool reportFrames(const char *name, const ScreenSize &size, F frame)
+{
+   oled.bus().recordTrace = false;
+   oled.bus().resetCounters();
+   uint32_t runs;
+   double ns = timeRuns(frame, runs);
+   printf("%-13s %3dx%-3d %10.1f ns/frame  %5u bytes/frame (%u cmd, %u data), %u CS cycles, %u DC edges\n",
+          name, size.width, size.height, ns, (oled.bus().commandBytes + oled.bus().dataBytes) / runs,
+          oled.bus().commandBytes / runs, oled.bus().dataBytes / runs, oled.bus().csAssertions / runs,
+          oled.bus().dcEdges / runs);
+   oled.bus().recordTrace = true;
+
+   if (oled.panelMatchesBuffer()) return true;
+   printf("%-13s %3dx%-3d panel GRAM does not match the framebuffer\n", name, size.width, size.height);
+   return false;
+}
+
+int main()
+{
+   bool ok = true;
+
+#if defined(OLEDDISPLAY_DOUBLE_BUFFER)
+   printf("change detection: back buffer\n");
+#elif defined(OLEDDISPLAY_PAGE_HASH)
+   printf("change detection: page hash, %u columns per segment\n", OLEDDISPLAY_PAGE_HASH_SEGMENT);
+#else
+   printf("change detection: dirty spans only\n");
+#endif
+#ifdef OLEDDISPLAY_DISPLAY_LIST
+   printf("display list: %u bytes\n", OLEDDISPLAY_DISPLAY_LIST);
+#endif
+   printf("%-13s %-7s %18s   %-8s\n", "case", "size", "time", "checksum");
+   for (uint8_t s = 0; s < SIZE_COUNT; s++)
+   {
+      const ScreenSize &size = sizes[s];
+      oled.end();
+      oled.setScreenSize(size.width, size.height);
+      oled.init();
+#if defined(OLEDDISPLAY_DOUBLE_BUFFER)
+      uint16_t stateBytes = size.width * size.height / 8;
+#elif defined(OLEDDISPLAY_PAGE_HASH)
+      uint16_t stateBytes = 4 * (size.height / 8) *
+                            ((size.width + OLEDDISPLAY_PAGE_HASH_SEGMENT - 1) / OLEDDISPLAY_PAGE_HASH_SEGMENT);
+#else
+      uint16_t stateBytes = 0;
+#endif
+      printf("%-13s %3dx%-3d %10u bytes of change detection RAM\n", "", size.width, size.height, stateBytes);
+#ifdef OLEDDISPLAY_DISPLAY_LIST
+      // The framebuffer checks below read `buffer`, which is just a page here
+      ok &= reportDisplayList(size, s);
+      continue;
+#endif
+
+      for (uint8_t c = 0; c < CASE_COUNT; c++)
+      {
+         const BenchCase &bench = cases[c];
+
+         oled.clear();
+#ifdef OLEDDISPLAY_GLYPH_CACHE
+         oled.resetGlyphCacheStats();
+#endif
+         uint32_t calls    = bench.draw(oled, size.width, size.height);
+         uint32_t checksum = bufferChecksum();
+
+         uint32_t runs;
+         double ns = timeRuns([&]() { bench.draw(oled, size.width, size.height); }, runs);
+         ok &= report(bench.name, size, ns / calls, checksum, bench.golden[s]);
+         if (bench.draw == drawGlyphs)
+         {
+            printf("%-13s %3dx%-3d %10.0f glyphs/s\n", "", size.width, size.height, 1e9 * calls / ns);
+#ifdef OLEDDISPLAY_GLYPH_CACHE
+            printf("%-13s %3dx%-3d %10u glyph cache hits, %u misses\n", "", size.width, size.height,
+                   oled.getGlyphCacheHits(), oled.getGlyphCacheMisses());
+#endif
+         }
+      }
+
+      ok &= checkUtf8(size);
+      ok &= checkCircleSpans(size);
+      ok &= checkLines(size);
+      ok &= checkLogBuffer(size);
+      ok &= checkUi(size);
+      ok &= checkPanelScroll(size);
+
+      // Measuring is what TEXT_ALIGN_CENTER and RIGHT add to every line
+      const char *line = "Lorem ipsum dolor sit amet, 12:34:56";
+      volatile uint32_t widths = 0;
+      uint32_t runs;
+      double ns = timeRuns([&]() { widths += oled.getStringWidth(line); }, runs);
+      printf("%-13s %3dx%-3d %10.1f ns/char\n", "stringWidth", size.width, size.height, ns / strlen(line));
+
+      ok &= reportWrap(size);
+      ok &= reportRleFonts(size);
+      ok &= checkFontSubset(size);
+      ok &= reportScaledFonts(size);
+
+      // display(): checked against the emulated panel, timed without tracing
+      oled.clear();
+      drawFrame(oled, size.width, size.height);
+      oled.display();
+      uint32_t checksum = bufferChecksum();
+      if (!oled.panelMatchesBuffer())
+      {
+         printf("display()    %3dx%-3d panel GRAM does not match the framebuffer\n", size.width, size.height);
+         ok = false;
+      }
+      bool frameOk = checksum == displayGolden[s];
+      printf("%-13s %3dx%-3d %18s   %08x  %s\n", "display()", size.width, size.height, "", checksum,
+             frameOk ? "ok" : "MISMATCH");
+      ok &= frameOk;
+
+      // A full frame, what every display() cost without dirty tracking
+      ok &= reportFrames("  full", size, [&]() {
+         oled.invalidate();
+         oled.display();
+      });
+
+      // The watch face redrawn from scratch every second
+      uint32_t tick = 0;
+      ok &= reportFrames("  clock", size, [&]() {
+         oled.clear();
+         drawClock(oled, ++tick);
+         oled.display();
+      });
+
+      // Only the seconds redrawn
+      ok &= reportFrames("  seconds", size, [&]() {
+         drawClockSeconds(oled, ++tick);
+         oled.display();
+      });
+
+      // displayAsync() against display() on a full frame, then on the
+      // partial updates of the seconds
+      oled.clear();
+      drawFrame(oled, size.width, size.height);
+      ok &= checkAsyncFrame(size);
+      // A flush that never finishes would leave the next displayAsync()
+      // waiting forever
+      if (!checkAsyncInstant(size))
+      {
+         printf("CHECKSUM MISMATCH\n");
+         return 1;
+      }
+      ok &= reportFrames("  async secs", size, [&]() {
+         drawClockSeconds(oled, ++tick);
+         ok &= flushAsync();
+      });
+
+#ifndef OLEDDISPLAY_DISPLAY_LIST
+      // Last, init() resets the panel model `oled` draws to
+      ok &= s == 0 ? reportStaticDisplay(oled64, size, s) : reportStaticDisplay(oled128, size, s);
+#endif
+   }
+
+   printf(ok ? "all checksums match\n" : "CHECKSUM MISMATCH\n");
+   return ok ? 0 : 1;
+}
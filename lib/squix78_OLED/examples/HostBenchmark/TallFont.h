@@ -0,0 +1,72 @@
+// The digits and the colon of ArialMT_Plain_10 stretched to 6 times their
+// height, 78 rows. TallDigits_RLE is TallDigits through tools/fontrle.py
+#ifndef TALLFONT_h
+#define TALLFONT_h
+
+constexpr char TallDigits[] PROGMEM = {
+  0x0A, // Width: 10
+  0x4E, // Height: 78
+  0x30, // First Char: 48
+  0x0B, // Numbers of Chars: 11
+
+  // Jump Table:
+  0x00, 0x00, 0x2F, 0x06,  // 48:0
+  0x00, 0x2F, 0x26, 0x06,  // 49:47
+  0x00, 0x55, 0x30, 0x06,  // 50:85
+  0x00, 0x85, 0x2F, 0x06,  // 51:133
+  0x00, 0xB4, 0x38, 0x06,  // 52:180
+  0x00, 0xEC, 0x2F, 0x06,  // 53:236
+  0x01, 0x1B, 0x2F, 0x06,  // 54:283
+  0x01, 0x4A, 0x2B, 0x06,  // 55:330
+  0x01, 0x75, 0x2F, 0x06,  // 56:373
+  0x01, 0xA4, 0x2F, 0x06,  // 57:420
+  0x01, 0xD3, 0x12, 0x03,  // 58:467
+
+  // Font Data:
+  0x00,0x00,0x00,0xFF,0xFF,0xFF,0x3F,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x3F,  // 48
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0xFF,0x0F,  // 49
+  0x00,0x00,0x00,0x3F,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0xFC,0xC0,0x0F,0x00,0x00,0x00,0x00,0xFC,0x00,0xF0,0x03,0xC0,0x0F,0x00,0x00,0x00,0x00,0x00,0xFF,0x0F,0x00,0xC0,0x0F,  // 50
+  0x00,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0xFC,0x00,0xF0,0x03,0xC0,0x0F,0x00,0x00,0x00,0x00,0xFC,0x00,0xF0,0x03,0xC0,0x0F,0x00,0x00,0x00,0x00,0x00,0xFF,0x0F,0xFC,0x3F,  // 51
+  0x00,0x00,0x00,0x00,0xF0,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x0F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0xFF,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,  // 52
+  0x00,0x00,0x00,0xC0,0xFF,0x03,0x3F,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0x0F,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0xFC,0xC0,0x0F,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0xFC,0xC0,0x0F,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0xFC,0x00,0xF0,0xFF,0x3F,  // 53
+  0x00,0x00,0x00,0xFF,0xFF,0xFF,0x3F,0x00,0x00,0x00,0x00,0x00,0xFC,0xC0,0x0F,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0xFC,0xC0,0x0F,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0xFC,0xC0,0x0F,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x00,0x3F,0xF0,0xFF,0x3F,  // 54
+  0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0xFF,0x0F,0x00,0x00,0x00,0x00,0xFC,0x00,0xF0,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,  // 55
+  0x00,0x00,0x00,0xFF,0x0F,0xFC,0x3F,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xF0,0x03,0xC0,0x0F,0x00,0x00,0x00,0x00,0xFC,0x00,0xF0,0x03,0xC0,0x0F,0x00,0x00,0x00,0x00,0xFC,0x00,0xF0,0x03,0xC0,0x0F,0x00,0x00,0x00,0x00,0x00,0xFF,0x0F,0xFC,0x3F,  // 56
+  0x00,0x00,0x00,0xFF,0xFF,0x03,0x3F,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0xFC,0xC0,0x0F,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0xFC,0xC0,0x0F,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0xFC,0xC0,0x0F,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x3F,  // 57
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x0F,0x00,0xC0,0x0F,  // 58
+};
+
+constexpr char TallDigits_RLE[] PROGMEM = {
+  0x8A, // Width: 10, run length encoded
+  0x4E, // Height: 78
+  0x30, // First Char: 48
+  0x0B, // Numbers of Chars: 11
+
+  // Jump Table:
+  0x00, 0x00, 0x12, 0x06,  // 48:0
+  0x00, 0x12, 0x0C, 0x06,  // 49:18
+  0x00, 0x1E, 0x13, 0x06,  // 50:30
+  0x00, 0x31, 0x12, 0x06,  // 51:49
+  0x00, 0x43, 0x14, 0x06,  // 52:67
+  0x00, 0x57, 0x14, 0x06,  // 53:87
+  0x00, 0x6B, 0x14, 0x06,  // 54:107
+  0x00, 0x7F, 0x0F, 0x06,  // 55:127
+  0x00, 0x8E, 0x12, 0x06,  // 56:142
+  0x00, 0xA0, 0x14, 0x06,  // 57:160
+  0x00, 0xB4, 0x06, 0x03,  // 58:180
+
+  // Font Data:
+  0xF9,0xFF,0x0F,0xFC,0x6F,0xF0,0x6F,0xF6,0x6F,0xF0,0x6F,0xF6,0x6F,0xF0,0x6F,0xFC,0xFF,0x00,  // 48
+  0xFF,0xFF,0xFF,0xF3,0x6F,0xFF,0xF6,0x6F,0xFF,0xF6,0xFF,0xC0,  // 49
+  0xF9,0x6F,0x96,0xFF,0x66,0xF9,0xCF,0xF6,0x6F,0x36,0x66,0xFF,0x66,0xC6,0xC6,0xFF,0xCC,0xF3,0x60,  // 50
+  0xF9,0x6F,0x36,0xFF,0xC6,0xFF,0x06,0xFF,0x66,0xC6,0xC6,0xFF,0x66,0xC6,0xC6,0xFF,0xCC,0x6C,  // 51
+  0xFF,0x6C,0xFF,0xFF,0x06,0x66,0xFF,0xF9,0x6C,0x6F,0xFF,0x36,0xF3,0x6F,0xFF,0x3F,0xFC,0xFF,0xFF,0x06,  // 52
+  0xFF,0x0C,0x66,0xFF,0xCF,0x3F,0x36,0xFF,0x66,0x66,0xF3,0x6F,0xF6,0x66,0x6F,0x36,0xFF,0x66,0xCF,0x30,  // 53
+  0xF9,0xFF,0x0F,0xFC,0x66,0x6F,0x36,0xFF,0x66,0x66,0xF3,0x6F,0xF6,0x66,0x6F,0x36,0xFF,0xC6,0x6F,0x30,  // 54
+  0xF3,0x6F,0xFF,0xFC,0x6F,0x9C,0xFF,0x66,0xCC,0xFF,0xF3,0xF3,0xFF,0xFF,0x06,  // 55
+  0xF9,0xC6,0xCF,0xFC,0x6C,0x6C,0x6F,0xF6,0x6C,0x6C,0x6F,0xF6,0x6C,0x6C,0x6F,0xFC,0xC6,0xC0,  // 56
+  0xF9,0xF3,0x66,0xFF,0xC6,0xF3,0x66,0x6F,0xF6,0x6F,0x36,0x66,0xFF,0x66,0xF3,0x66,0x6F,0xFC,0xFF,0x00,  // 57
+  0xFF,0xFF,0xFF,0xF3,0x6F,0x36,  // 58
+};
+
+#endif
@@ -0,0 +1,14 @@
+// Generated by xbm2image.py from angry_cookie_64x32_xbm.h, draw with drawFastImage()
+#define angry_cookie_width 36
+#define angry_cookie_height 32
+const char angry_cookie_image[] PROGMEM = {
+  0x00, 0xFC, 0x0F, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xC0, 0x03, 0xC0, 0x01, 0xE0, 0x01, 0x00, 0x07,
+  0x70, 0x00, 0x00, 0x0E, 0x30, 0x00, 0x00, 0x1C, 0x08, 0x00, 0x00, 0x18, 0x0C, 0x80, 0x00, 0x30,
+  0x04, 0x80, 0xF1, 0x20, 0x06, 0x00, 0xF9, 0x60, 0x02, 0x00, 0xFD, 0x61, 0x03, 0x00, 0xFB, 0x41,
+  0x01, 0x00, 0xFA, 0x40, 0x01, 0x00, 0xF2, 0x40, 0x01, 0x00, 0x06, 0x84, 0x01, 0x00, 0x00, 0x87,
+  0x03, 0x00, 0x80, 0x81, 0x0E, 0x00, 0x80, 0x80, 0xFC, 0x00, 0x80, 0x80, 0xD8, 0x01, 0x80, 0x81,
+  0x00, 0x03, 0x00, 0xC3, 0x00, 0x02, 0x06, 0xC6, 0x00, 0x1E, 0x7A, 0xC0, 0x00, 0x30, 0xFF, 0xC0,
+  0x00, 0x20, 0xFD, 0x40, 0x00, 0x60, 0xFD, 0x60, 0x00, 0xE0, 0xFD, 0x60, 0x00, 0xA0, 0x78, 0x60,
+  0x00, 0x60, 0x00, 0x30, 0x00, 0xC0, 0x00, 0x18, 0x00, 0x80, 0x00, 0x1C, 0x00, 0x80, 0x01, 0x0E,
+  0x00, 0x80, 0x81, 0x07, 0x00, 0x80, 0xE0, 0x03, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0xC0, 0x1F, 0x00,
+};
@@ -0,0 +1,149 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+// Minimal stand-in for the Arduino core so the display library can be
+// compiled on a Linux host (see OLEDDisplay_Host.h and examples/HostBenchmark).
+// Only what the library itself uses is provided - this is not an emulator.
+// Add this directory to the include path: g++ -I<lib>/host -I<lib> ...
+
+#ifndef HOST_ARDUINO_h
+#define HOST_ARDUINO_h
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define ARDUINO 10800
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#define MSBFIRST 1
+#define LSBFIRST 0
+
+#ifndef min
+#define min(a,b) ((a) < (b) ? (a) : (b))
+#endif
+#ifndef max
+#define max(a,b) ((a) > (b) ? (a) : (b))
+#endif
+
+typedef uint8_t byte;
+typedef uint16_t word;
+typedef bool boolean;
+
+inline void yield() {}
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return LOW; }
+
+inline uint32_t micros()
+{
+   static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+   return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+              std::chrono::steady_clock::now() - start).count();
+}
+
+inline uint32_t millis() { return micros() / 1000; }
+
+inline void delay(uint32_t ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+
+class String
+{
+  public:
+   String(const char *cstr = "") : s(cstr ? cstr : "") {}
+   String(const std::string &str) : s(str) {}
+   explicit String(int value) : s(std::to_string(value)) {}
+   explicit String(unsigned int value) : s(std::to_string(value)) {}
+   explicit String(long value) : s(std::to_string(value)) {}
+   explicit String(unsigned long value) : s(std::to_string(value)) {}
+
+   unsigned int length() const { return s.length(); }
+   const char *c_str() const { return s.c_str(); }
+
+   void toCharArray(char *buf, unsigned int bufsize) const
+   {
+      if (!bufsize || !buf) return;
+      unsigned int len = s.length() < bufsize - 1 ? s.length() : bufsize - 1;
+      memcpy(buf, s.c_str(), len);
+      buf[len] = 0;
+   }
+
+   String &operator+=(const String &rhs) { s += rhs.s; return *this; }
+   String &operator+=(const char *rhs) { s += rhs; return *this; }
+   String &operator+=(char c) { s += c; return *this; }
+
+   friend String operator+(const String &lhs, const String &rhs) { return String(lhs.s + rhs.s); }
+   bool operator==(const String &rhs) const { return s == rhs.s; }
+   char operator[](unsigned int index) const { return s[index]; }
+
+  private:
+   std::string s;
+};
+
+class Print
+{
+  public:
+   virtual ~Print() {}
+   virtual size_t write(uint8_t) = 0;
+   virtual size_t write(const uint8_t *buffer, size_t size)
+   {
+      size_t n = 0;
+      while (size--) n += write(*buffer++);
+      return n;
+   }
+   size_t write(const char *str) { return str ? write((const uint8_t *)str, strlen(str)) : 0; }
+
+   size_t print(const char *str) { return write(str); }
+   size_t print(const String &s) { return write(s.c_str()); }
+   size_t print(char c) { return write((uint8_t)c); }
+   size_t print(long n)
+   {
+      char buf[24];
+      snprintf(buf, sizeof(buf), "%ld", n);
+      return write(buf);
+   }
+   size_t print(int n) { return print((long)n); }
+
+   size_t println() { return write((uint8_t)'\n'); }
+   size_t println(const char *str) { return print(str) + println(); }
+   size_t println(const String &s) { return print(s) + println(); }
+   size_t println(long n) { return print(n) + println(); }
+   size_t println(int n) { return print(n) + println(); }
+};
+
+#endif
@@ -0,0 +1,159 @@
+#!/usr/bin/env python
+"""
+Run length encode fonts in the OLEDDisplay font format.
+
+A glyph is stored column by column, `height` pixels per column from the top,
+and the columns follow each other in one stream of pixels. That stream is
+written as the lengths of alternating runs of off and on pixels, starting
+with an off run (which may be 0 long). Every run length is a sequence of
+nibbles, high nibble first: 15 adds 15 and continues, 0..14 adds its value
+and ends the run. The off pixels after the last on pixel are not stored.
+
+The header and the jump table stay as they are, except that bit 7 of the
+first byte (the font width) is set to mark the encoding and the jump table
+sizes and offsets refer to the encoded data. Glyphs without any pixels get
+the 0xFFFF "not drawable" offset.
+
+Usage:
+    python fontrle.py OLEDDisplayFonts.h [suffix] > OLEDDisplayFontsRLE.h
+
+Every font array found in the input is written out with `suffix` (default
+_RLE) appended to its name. A summary of the sizes goes to stderr.
+"""
+
+from __future__ import print_function
+
+import re
+import sys
+
+JUMPTABLE_START = 4
+JUMPTABLE_BYTES = 4
+COMPRESSED = 0x80
+
+
+def parse_fonts(text):
+    fonts = []
+    pattern = r'(?:const|constexpr)\s+(?:uint8_t|char)\s+(\w+)\[\]\s*PROGMEM\s*=\s*\{(.*?)\};'
+    for match in re.finditer(pattern, text, re.S):
+        body = re.sub(r'//[^\n]*', '', match.group(2))
+        data = [int(v, 0) for v in re.findall(r'0[xX][0-9a-fA-F]+|\d+', body)]
+        fonts.append((match.group(1), data))
+    return fonts
+
+
+def glyph_pixels(data, height):
+    raster = (height + 7) // 8
+    columns = (len(data) + raster - 1) // raster
+    data = data + [0] * (columns * raster - len(data))
+    pixels = []
+    for column in range(columns):
+        for y in range(height):
+            pixels.append((data[column * raster + (y >> 3)] >> (y & 7)) & 1)
+    while pixels and not pixels[-1]:
+        pixels.pop()
+    return pixels
+
+
+def encode_pixels(pixels):
+    runs = []
+    color, length = 0, 0
+    for pixel in pixels:
+        if pixel == color:
+            length += 1
+        else:
+            runs.append(length)
+            color, length = pixel, 1
+    if pixels:
+        runs.append(length)
+
+    nibbles = []
+    for length in runs:
+        while length >= 15:
+            nibbles.append(15)
+            length -= 15
+        nibbles.append(length)
+    # An odd nibble count is padded with an empty run, it draws nothing
+    if len(nibbles) & 1:
+        nibbles.append(0)
+    return [(nibbles[i] << 4) | nibbles[i + 1] for i in range(0, len(nibbles), 2)]
+
+
+def encode_font(font):
+    width, height, first_char, char_num = font[:4]
+    if width & COMPRESSED:
+        raise ValueError('font is already encoded')
+    raster = (height + 7) // 8
+    data_start = JUMPTABLE_START + char_num * JUMPTABLE_BYTES
+
+    jump_table, glyphs, chars = [], [], []
+    offset = 0
+    for i in range(char_num):
+        msb, lsb, size, advance = font[JUMPTABLE_START + i * JUMPTABLE_BYTES:][:JUMPTABLE_BYTES]
+        encoded = []
+        if not (msb == 0xFF and lsb == 0xFF):
+            start = data_start + ((msb << 8) | lsb)
+            size = size if size else advance * raster
+            encoded = encode_pixels(glyph_pixels(font[start:start + size], height))
+        if not encoded:
+            jump_table.append([0xFF, 0xFF, 0x00, advance])
+        else:
+            if len(encoded) > 255:
+                raise ValueError('glyph %d does not fit the jump table' % (first_char + i))
+            jump_table.append([offset >> 8, offset & 0xFF, len(encoded), advance])
+            glyphs.append(encoded)
+            chars.append(first_char + i)
+            offset += len(encoded)
+    return [width | COMPRESSED, height, first_char, char_num], jump_table, glyphs, chars
+
+
+def hex_list(values):
+    return ','.join('0x%02X' % v for v in values)
+
+
+def write_font(name, header, jump_table, glyphs, chars, out):
+    width, height, first_char, char_num = header
+    print('constexpr char %s[] PROGMEM = {' % name, file=out)
+    print('  0x%02X, // Width: %d, run length encoded' % (width, width & ~COMPRESSED), file=out)
+    print('  0x%02X, // Height: %d' % (height, height), file=out)
+    print('  0x%02X, // First Char: %d' % (first_char, first_char), file=out)
+    print('  0x%02X, // Numbers of Chars: %d' % (char_num, char_num), file=out)
+    print('', file=out)
+    print('  // Jump Table:', file=out)
+    for i, entry in enumerate(jump_table):
+        print('  %s,  // %d:%d' % (', '.join('0x%02X' % v for v in entry), first_char + i,
+                                   (entry[0] << 8) | entry[1]), file=out)
+    print('', file=out)
+    print('  // Font Data:', file=out)
+    for char, data in zip(chars, glyphs):
+        print('  %s,  // %d' % (hex_list(data), char), file=out)
+    print('};', file=out)
+
+
+def main(argv):
+    if len(argv) < 2:
+        print(__doc__.strip(), file=sys.stderr)
+        return 1
+
+    suffix = argv[2] if len(argv) > 2 else '_RLE'
+    with open(argv[1]) as f:
+        fonts = parse_fonts(f.read())
+
+    guard = re.sub(r'\W', '_', argv[1].split('/')[-1].split('.')[0]).upper() + suffix.upper() + '_h'
+    out = sys.stdout
+    print('// Generated by tools/fontrle.py from %s' % argv[1].split('/')[-1], file=out)
+    print('#ifndef %s' % guard, file=out)
+    print('#define %s' % guard, file=out)
+    for name, font in fonts:
+        header, jump_table, glyphs, chars = encode_font(font)
+        encoded = len(header) + 4 * len(jump_table) + sum(len(g) for g in glyphs)
+        print('', file=out)
+        write_font(name + suffix, header, jump_table, glyphs, chars, out)
+        print('%-20s %6d bytes -> %6d bytes (%.0f%%)' % (name, len(font), encoded,
+                                                          100.0 * encoded / len(font)), file=sys.stderr)
+    print('', file=out)
+    print('#endif', file=out)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
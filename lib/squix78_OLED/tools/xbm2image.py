@@ -0,0 +1,76 @@
+#!/usr/bin/env python
+"""
+Convert an XBM bitmap into the page format used by OLEDDisplay::drawFastImage.
+
+XBM stores the image row by row, 8 pixels per byte with the leftmost pixel in
+bit 0. The display buffer is organised in pages of 8 rows: every byte is one
+column of a page with the top pixel in bit 0. drawXbm() transposes the image
+on every call; converting it once here lets drawFastImage() copy it straight
+into the framebuffer.
+
+Usage:
+    python xbm2image.py angry_cookie_64x32_xbm.h [name] > angry_cookie_image.h
+
+The input may be a plain .xbm file (#define name_width / name_height) or a
+header using "width = N; height = N;" constants like the examples do.
+"""
+
+from __future__ import print_function
+
+import re
+import sys
+
+
+def parse_xbm(text):
+    width = re.search(r'width\s*=?\s*(\d+)', text)
+    height = re.search(r'height\s*=?\s*(\d+)', text)
+    if not width or not height:
+        raise ValueError('no width/height found')
+    body = text[text.index('{', text.index('[')) + 1:]
+    body = body[:body.index('}')]
+    data = [int(v, 0) for v in re.findall(r'0[xX][0-9a-fA-F]+|\d+', body)]
+    return int(width.group(1)), int(height.group(1)), data
+
+
+def xbm_to_pages(width, height, data):
+    row_bytes = (width + 7) // 8
+    if len(data) < row_bytes * height:
+        raise ValueError('expected %d bytes, got %d' % (row_bytes * height, len(data)))
+
+    pages = (height + 7) // 8
+    image = []
+    # drawFastImage reads column by column, every column holds `pages` bytes
+    for x in range(width):
+        for page in range(pages):
+            byte = 0
+            for bit in range(8):
+                y = page * 8 + bit
+                if y < height and data[y * row_bytes + x // 8] & (1 << (x & 7)):
+                    byte |= 1 << bit
+            image.append(byte)
+    return image
+
+
+def main(argv):
+    if len(argv) < 2:
+        print(__doc__.strip(), file=sys.stderr)
+        return 1
+
+    with open(argv[1]) as f:
+        width, height, data = parse_xbm(f.read())
+    name = argv[2] if len(argv) > 2 else re.sub(r'\W', '_', argv[1].split('/')[-1].split('.')[0])
+
+    image = xbm_to_pages(width, height, data)
+
+    print('// Generated by xbm2image.py from %s, draw with drawFastImage()' % argv[1])
+    print('#define %s_width %d' % (name, width))
+    print('#define %s_height %d' % (name, height))
+    print('const char %s_image[] PROGMEM = {' % name)
+    for i in range(0, len(image), 16):
+        print('  ' + ', '.join('0x%02X' % b for b in image[i:i + 16]) + ',')
+    print('};')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -37,6 +37,8 @@ This example code is in the public domain.
 
 #include <Arduino.h>
 #include <SSD1306Spi.h>
+#include <OLEDDisplayFontSubset.h>
+#include <OLEDDisplayStatic.h>
 #include <TimeLib.h>//get this lib here: https://github.com/PaulStoffregen/Time
 #include <compile_time.h>//macro for build time as unix time, for setting clock,optional
 #include <BLEPeripheral.h>
@@ -46,7 +48,11 @@ uint32_t last_wakeup = 0;
 //#define BOOTLOADER_DFU_START (0xB1)
 #define OLED_WIDTH 64
 #define OLED_HEIGHT 32
-SSD1306Spi oled(OLED_RST, OLED_DC, OLED_CS); // (pin_rst, pin_dc, pin_cs)
+OLEDDisplayStatic<SSD1306Spi, OLED_WIDTH, OLED_HEIGHT> oled(OLED_RST, OLED_DC, OLED_CS); // (pin_rst, pin_dc, pin_cs), framebuffer in .bss
+//only the glyphs of "CLOCK", "RECEIVED", the date and the time get linked,
+//add chars here before drawing new ones
+typedef OLEDFontSubset<ArialMT_Plain_10, 'C', 'L', 'O', 'K', 'R', 'E', 'I', 'V', 'D',
+	'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '.', ':'> WatchFont;
 
 char * months [] = {"Unknown", "January", "February", "March", "April", "May", "June", "July", "August", "September", "October", "November", "December"};
 char * days [] = {"Unknown", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday", "Sunday"};
@@ -149,12 +155,15 @@ void draw_clock(){  //draw clock on OLED
 	char buffer[11];
 	time_t time_now = now();
 	oled.clear();
+	// Rows on page boundaries (0, 8, 16) take the straight byte copy blit,
+	// the ink of ArialMT_Plain_10 is only 7 rows high so the lines still fit
 	oled.drawString(0, 0, "CLOCK");
 	sprintf(buffer,"%02d.%02d.%04d",day(time_now),month(time_now),year(time_now));
-	oled.drawString(0, 10, buffer);
+	oled.drawString(0, 8, buffer);
 	sprintf(buffer,"%02d:%02d:%02d",hour(time_now),minute(time_now),second(time_now));
-	oled.drawString(0,20,buffer);
-	oled.display();
+	oled.drawString(0, 16, buffer);
+	oled.displayAsync(NULL);
+	while (oled.displayBusy()) __WFE();//sleep between SPI interrupts
 }
 
 void setup() {
@@ -197,7 +206,7 @@ void setup() {
 	oled.init();
 	oled.flipScreenVertically();
 	oled.setTextAlignment(TEXT_ALIGN_LEFT);
-	oled.setFont(ArialMT_Plain_10);
+	oled.setFont(WatchFont::data);
 
 	// Configure and Enable interrupt on nRF side
 	//	NRF_GPIO->PIN_CNF[PIN_BUTTON2] |= (GPIO_PIN_CNF_SENSE_High << GPIO_PIN_CNF_SENSE_Pos);
@@ -248,7 +257,7 @@ void loop() {
 			//		err_code=sd_power_gpregret_set(0xB1); //reset the nrf51822
 			myString = String(err_code);
 			//memset(&dfus_init, 0, sizeof(dfus_init));	
-			oled.drawString(0, 10 ,myString);
+			oled.drawString(0, 8, myString);
 			delay(3000);
 			oled.display();
 			sd_power_gpregret_set(0xBB); //in honour of Brigitte Bardot -- initiales BB